@@ -0,0 +1,184 @@
+import argparse
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+import time
+
+REPO_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# Runs one Python solver inside a child process: logging is disabled and only the solve itself is timed
+PYTHON_RUNNER = r"""
+import logging, sys, time
+sys.path.insert(0, sys.argv[1])
+import main
+logging.disable(logging.CRITICAL)
+task, input_filename = sys.argv[2], sys.argv[3]
+
+if task == "task_1":
+    segments = main.read_segments_data_from_input_file(input_filename)
+    start = time.perf_counter()
+    count, points = main.find_minimum_points_to_cover_all_segments(segments)
+    seconds = time.perf_counter() - start
+    print("count", count)
+    print(" ".join(["points"] + [str(point) for point in points]))
+else:
+    with open(input_filename) as input_file:
+        triangle = [[int(value) for value in line.split()] for line in input_file if line.strip()]
+    start = time.perf_counter()
+    min_sum, path = main.minimum_total(triangle)
+    seconds = time.perf_counter() - start
+    print("sum", min_sum)
+    print("path", " -> ".join(map(str, path)))
+print("seconds", seconds)
+with open("/proc/self/status") as status:
+    print("peak_kb", next((line.split()[1] for line in status if line.startswith("VmHWM:")), 0))
+"""
+
+TASKS = {
+    "task_1": {"sizes": [1000, 10000, 100000], "result_keys": ["count", "points"]},
+    "task_5": {"sizes": [50, 100, 200, 400, 800], "result_keys": ["sum", "path"]},
+}
+
+
+def write_segments_input(filename, size, seed):
+    """
+    Writes size segments with non-negative coordinates; the C++ solver uses -1 as its "no point yet" marker.
+    """
+    generator = random.Random(seed)
+    with open(filename, "w") as output_file:
+        output_file.write(f"{size}\n")
+        for _ in range(size):
+            start = generator.randint(0, 1000000)
+            output_file.write(f"{start} {start + generator.randint(0, 10000)}\n")
+
+
+def write_triangle_input(filename, size, seed):
+    generator = random.Random(seed)
+    with open(filename, "w") as output_file:
+        for row in range(size):
+            output_file.write(" ".join(str(generator.randint(-100, 100)) for _ in range(row + 1)) + "\n")
+
+
+def build_cpp_solver(task, build_dir, compiler):
+    binary = os.path.join(build_dir, task)
+    command = [compiler, "-std=c++17", "-O2", "-pthread", os.path.join(REPO_DIR, task, "main.cpp"), "-o", binary]
+    subprocess.run(command, check=True)
+    return binary
+
+
+def run_solver(command, work_dir, timeout):
+    """
+    Runs one solver and returns its parsed output, wall time and peak resident memory in MB.
+    Solvers report their own VmHWM; ru_maxrss from os.wait4 is only a fallback because it also
+    counts the memory the child inherited from this process before exec.
+    """
+    start = time.perf_counter()
+    with tempfile.TemporaryFile(mode="w+") as stdout_file, tempfile.TemporaryFile(mode="w+") as stderr_file:
+        process = subprocess.Popen(command, cwd=work_dir, stdout=stdout_file, stderr=stderr_file)
+        deadline = start + timeout
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            if time.perf_counter() > deadline:
+                process.kill()
+                os.wait4(process.pid, 0)
+                return None
+            time.sleep(0.001)
+        process.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+        wall_seconds = time.perf_counter() - start
+
+        stdout_file.seek(0)
+        stderr_file.seek(0)
+        if process.returncode != 0:
+            raise RuntimeError(f"{command[0]} failed: {stderr_file.read().strip()}")
+
+        result = {"wall_seconds": wall_seconds}
+        for line in stdout_file.read().splitlines():
+            key, _, value = line.partition(" ")
+            result[key] = value
+    result["seconds"] = float(result["seconds"])
+    peak_kb = int(result.pop("peak_kb", 0))
+    result["peak_mb"] = (peak_kb or usage.ru_maxrss) / 1024.0
+    return result
+
+
+def best_of(command, work_dir, repeats, timeout):
+    runs = []
+    for _ in range(repeats):
+        run = run_solver(command, work_dir, timeout)
+        if run is None:
+            return None
+        runs.append(run)
+    best = min(runs, key=lambda run: run["seconds"])
+    best["peak_mb"] = max(run["peak_mb"] for run in runs)
+    return best
+
+
+def compare_task(task, sizes, seed, repeats, timeout, cpp_binary, work_dir):
+    rows = []
+    for size in sizes:
+        input_filename = os.path.join(work_dir, f"{task}_{size}.txt")
+        writer = write_segments_input if task == "task_1" else write_triangle_input
+        writer(input_filename, size, seed + size)
+
+        cpp = best_of([cpp_binary, "--solve-quiet", input_filename], work_dir, repeats, timeout)
+        python = best_of([sys.executable, "-c", PYTHON_RUNNER, os.path.join(REPO_DIR, task), task, input_filename],
+                         work_dir, repeats, timeout)
+
+        row = {"task": task, "size": size, "cpp": cpp, "python": python}
+        if cpp and python:
+            row["agree"] = all(cpp[key] == python[key] for key in TASKS[task]["result_keys"])
+            row["speedup"] = python["seconds"] / cpp["seconds"] if cpp["seconds"] > 0 else float("inf")
+        rows.append(row)
+        print_row(row)
+    return rows
+
+
+def print_row(row):
+    def cell(run, key, fmt):
+        return fmt.format(run[key]) if run else "timeout"
+
+    agree = {True: "yes", False: "NO"}.get(row.get("agree"), "-")
+    speedup = f"{row['speedup']:.1f}x" if "speedup" in row else "-"
+    print(f"{row['task']:<7} {row['size']:>8} "
+          f"{cell(row['cpp'], 'seconds', '{:.6f}'):>12} {cell(row['python'], 'seconds', '{:.6f}'):>12} {speedup:>9} "
+          f"{cell(row['cpp'], 'peak_mb', '{:.1f}'):>9} {cell(row['python'], 'peak_mb', '{:.1f}'):>9} {agree:>6}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Differential benchmark of the C++ and Python solvers")
+    parser.add_argument("--task", choices=["task_1", "task_5", "all"], default="all")
+    parser.add_argument("--sizes", type=int, nargs="+", help="input sizes (segments or triangle rows)")
+    parser.add_argument("--seed", type=int, default=2024)
+    parser.add_argument("--repeats", type=int, default=3, help="runs per size; the fastest solve is reported")
+    parser.add_argument("--timeout", type=float, default=120.0, help="seconds per run")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "g++"))
+    parser.add_argument("--json", help="write all measurements to this file")
+    args = parser.parse_args()
+
+    tasks = list(TASKS) if args.task == "all" else [args.task]
+    all_rows = []
+    with tempfile.TemporaryDirectory() as work_dir:
+        print(f"{'task':<7} {'size':>8} {'C++ s':>12} {'Python s':>12} {'speedup':>9} "
+              f"{'C++ MB':>9} {'Py MB':>9} {'agree':>6}")
+        for task in tasks:
+            cpp_binary = build_cpp_solver(task, work_dir, args.cxx)
+            sizes = args.sizes or TASKS[task]["sizes"]
+            all_rows += compare_task(task, sizes, args.seed, args.repeats, args.timeout, cpp_binary, work_dir)
+
+    if args.json:
+        with open(args.json, "w") as output_file:
+            json.dump(all_rows, output_file, indent=2)
+
+    disagreements = [row for row in all_rows if row.get("agree") is False]
+    for row in disagreements:
+        print(f"Results differ for {row['task']} size {row['size']}", file=sys.stderr)
+    return 1 if disagreements else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
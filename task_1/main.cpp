@@ -8,11 +8,26 @@
 #include <stdexcept>
 #include <chrono>
 #include <iomanip>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <random>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SEGMENTS_X86_DISPATCH 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
 
 class Logger {
 private:
     std::ofstream log_file;
     bool debug_enabled;
+    bool enabled = true;
 
 public:
     Logger(const std::string& filename = "task.log", bool debug = false) 
@@ -29,7 +44,12 @@ public:
         }
     }
 
+    void set_enabled(bool value) {
+        enabled = value;
+    }
+
     void info(const std::string& message) {
+        if (!enabled) return;
         std::string timestamp = get_current_timestamp();
         std::string log_message = timestamp + " - INFO - " + message;
         std::cout << log_message << std::endl;
@@ -37,7 +57,7 @@ public:
     }
 
     void debug(const std::string& message) {
-        if (debug_enabled) {
+        if (enabled && debug_enabled) {
             std::string timestamp = get_current_timestamp();
             std::string log_message = timestamp + " - DEBUG - " + message;
             std::cout << log_message << std::endl;
@@ -46,6 +66,7 @@ public:
     }
 
     void warning(const std::string& message) {
+        if (!enabled) return;
         std::string timestamp = get_current_timestamp();
         std::string log_message = timestamp + " - WARNING - " + message;
         std::cout << log_message << std::endl;
@@ -53,6 +74,7 @@ public:
     }
 
     void error(const std::string& message) {
+        if (!enabled) return;
         std::string timestamp = get_current_timestamp();
         std::string log_message = timestamp + " - ERROR - " + message;
         std::cerr << log_message << std::endl;
@@ -73,6 +95,304 @@ private:
     }
 };
 
+// Segment kernels work on std::pair<int, int> as two adjacent ints: start in the low half, end in the high half
+static_assert(sizeof(std::pair<int, int>) == 2 * sizeof(int), "pair<int, int> must be two packed ints");
+
+// Sort key: biased end in the high 32 bits, original index in the low 32 bits,
+// so ordering the keys orders the segments by right endpoint with ties by input position
+const uint64_t SORT_KEY_END_MASK = 0xFFFFFFFF00000000ull;
+const uint64_t SORT_KEY_SIGN_BIAS = 0x8000000000000000ull;
+const uint64_t SORT_KEY_MAX_SEGMENTS = uint64_t{1} << 32;    // the index must fit in the low half
+
+size_t find_invalid_segment_scalar(const std::pair<int, int>* segments, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (segments[i].first > segments[i].second) return i;
+    }
+    return count;
+}
+
+void build_sort_keys_scalar(const std::pair<int, int>* segments, size_t count, uint64_t* keys) {
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t end = static_cast<uint32_t>(segments[i].second);
+        keys[i] = ((end << 32) ^ SORT_KEY_SIGN_BIAS) | i;
+    }
+}
+
+#if defined(SEGMENTS_X86_DISPATCH)
+__attribute__((target("sse4.2")))
+size_t find_invalid_segment_sse42(const std::pair<int, int>* segments, size_t count) {
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(segments + i));
+        __m128i swapped = _mm_shuffle_epi32(pairs, 0xB1);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(pairs, swapped))) & 0x5;
+        if (mask) return i + __builtin_ctz(mask) / 2;
+    }
+    return i + find_invalid_segment_scalar(segments + i, count - i);
+}
+
+__attribute__((target("sse4.2")))
+void build_sort_keys_sse42(const std::pair<int, int>* segments, size_t count, uint64_t* keys) {
+    const __m128i end_mask = _mm_set1_epi64x(static_cast<long long>(SORT_KEY_END_MASK));
+    const __m128i bias = _mm_set1_epi64x(static_cast<long long>(SORT_KEY_SIGN_BIAS));
+    __m128i index = _mm_set_epi64x(1, 0);
+    const __m128i step = _mm_set1_epi64x(2);
+
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i pairs = _mm_loadu_si128(reinterpret_cast<const __m128i*>(segments + i));
+        __m128i key = _mm_or_si128(_mm_xor_si128(_mm_and_si128(pairs, end_mask), bias), index);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(keys + i), key);
+        index = _mm_add_epi64(index, step);
+    }
+    for (; i < count; ++i) {
+        uint64_t end = static_cast<uint32_t>(segments[i].second);
+        keys[i] = ((end << 32) ^ SORT_KEY_SIGN_BIAS) | i;
+    }
+}
+
+__attribute__((target("avx2")))
+size_t find_invalid_segment_avx2(const std::pair<int, int>* segments, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i pairs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(segments + i));
+        __m256i swapped = _mm256_shuffle_epi32(pairs, 0xB1);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pairs, swapped))) & 0x55;
+        if (mask) return i + __builtin_ctz(mask) / 2;
+    }
+    return i + find_invalid_segment_scalar(segments + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void build_sort_keys_avx2(const std::pair<int, int>* segments, size_t count, uint64_t* keys) {
+    const __m256i end_mask = _mm256_set1_epi64x(static_cast<long long>(SORT_KEY_END_MASK));
+    const __m256i bias = _mm256_set1_epi64x(static_cast<long long>(SORT_KEY_SIGN_BIAS));
+    __m256i index = _mm256_set_epi64x(3, 2, 1, 0);
+    const __m256i step = _mm256_set1_epi64x(4);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i pairs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(segments + i));
+        __m256i key = _mm256_or_si256(_mm256_xor_si256(_mm256_and_si256(pairs, end_mask), bias), index);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(keys + i), key);
+        index = _mm256_add_epi64(index, step);
+    }
+    for (; i < count; ++i) {
+        uint64_t end = static_cast<uint32_t>(segments[i].second);
+        keys[i] = ((end << 32) ^ SORT_KEY_SIGN_BIAS) | i;
+    }
+}
+
+__attribute__((target("avx512f")))
+size_t find_invalid_segment_avx512(const std::pair<int, int>* segments, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512i pairs = _mm512_loadu_si512(segments + i);
+        // Merge form with an explicit source: GCC 12's plain _mm512_shuffle_epi32 warns -Wmaybe-uninitialized
+        __m512i swapped = _mm512_mask_shuffle_epi32(pairs, 0xFFFF, pairs, _MM_PERM_CDAB);
+        unsigned mask = _mm512_cmpgt_epi32_mask(pairs, swapped) & 0x5555u;
+        if (mask) return i + __builtin_ctz(mask) / 2;
+    }
+    return i + find_invalid_segment_scalar(segments + i, count - i);
+}
+
+__attribute__((target("avx512f")))
+void build_sort_keys_avx512(const std::pair<int, int>* segments, size_t count, uint64_t* keys) {
+    const __m512i end_mask = _mm512_set1_epi64(static_cast<long long>(SORT_KEY_END_MASK));
+    const __m512i bias = _mm512_set1_epi64(static_cast<long long>(SORT_KEY_SIGN_BIAS));
+    __m512i index = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+    const __m512i step = _mm512_set1_epi64(8);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512i pairs = _mm512_loadu_si512(segments + i);
+        __m512i key = _mm512_or_si512(_mm512_xor_si512(_mm512_and_si512(pairs, end_mask), bias), index);
+        _mm512_storeu_si512(keys + i, key);
+        index = _mm512_add_epi64(index, step);
+    }
+    for (; i < count; ++i) {
+        uint64_t end = static_cast<uint32_t>(segments[i].second);
+        keys[i] = ((end << 32) ^ SORT_KEY_SIGN_BIAS) | i;
+    }
+}
+#endif
+
+enum class CpuLevel { Scalar, SSE42, AVX2, AVX512 };
+
+const char* cpu_level_name(CpuLevel level) {
+    switch (level) {
+        case CpuLevel::SSE42: return "sse4.2";
+        case CpuLevel::AVX2: return "avx2";
+        case CpuLevel::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+bool parse_cpu_level(const std::string& name, CpuLevel& level) {
+    for (CpuLevel candidate : {CpuLevel::Scalar, CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512}) {
+        if (name == cpu_level_name(candidate)) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// CPUID feature bits plus an XGETBV check that the OS saves the wider registers; AVX512 means F and BW
+CpuLevel detect_cpu_level() {
+#if defined(SEGMENTS_X86_DISPATCH)
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return CpuLevel::Scalar;
+
+    bool sse42 = ecx & (1u << 20);
+    bool osxsave = ecx & (1u << 27);
+    bool avx = ecx & (1u << 28);
+    if (!sse42) return CpuLevel::Scalar;
+    if (!osxsave || !avx) return CpuLevel::SSE42;
+
+    unsigned xcr0_low, xcr0_high;
+    __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+    bool ymm_state = (xcr0_low & 0x6) == 0x6;
+    bool zmm_state = (xcr0_low & 0xe6) == 0xe6;
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !ymm_state) return CpuLevel::SSE42;
+    bool avx2 = ebx & (1u << 5);
+    bool avx512 = (ebx & (1u << 16)) && (ebx & (1u << 30));
+
+    if (avx512 && zmm_state) return CpuLevel::AVX512;
+    if (avx2) return CpuLevel::AVX2;
+    return CpuLevel::SSE42;
+#else
+    return CpuLevel::Scalar;
+#endif
+}
+
+// ENV=scalar|sse4.2|avx2|avx512 lowers the detected level, e.g. to test the fallbacks
+CpuLevel select_cpu_level(const char* variable) {
+    CpuLevel detected = detect_cpu_level();
+    const char* forced = std::getenv(variable);
+    CpuLevel level;
+    if (forced && parse_cpu_level(forced, level)) {
+        return std::min(level, detected);
+    }
+    return detected;
+}
+
+struct SegmentKernels {
+    CpuLevel level;
+    size_t (*find_invalid)(const std::pair<int, int>*, size_t);
+    void (*build_sort_keys)(const std::pair<int, int>*, size_t, uint64_t*);
+};
+
+SegmentKernels segment_kernels_for(CpuLevel level) {
+#if defined(SEGMENTS_X86_DISPATCH)
+    switch (level) {
+        case CpuLevel::AVX512: return {level, find_invalid_segment_avx512, build_sort_keys_avx512};
+        case CpuLevel::AVX2: return {level, find_invalid_segment_avx2, build_sort_keys_avx2};
+        case CpuLevel::SSE42: return {level, find_invalid_segment_sse42, build_sort_keys_sse42};
+        default: break;
+    }
+#endif
+    return {CpuLevel::Scalar, find_invalid_segment_scalar, build_sort_keys_scalar};
+}
+
+const SegmentKernels& segment_kernels() {
+    static const SegmentKernels kernels = segment_kernels_for(select_cpu_level("SEGMENTS_CPU_LEVEL"));
+    return kernels;
+}
+
+// Sort buffers from 2 MB up (about 260k segments) are mapped on a 2 MB boundary and advised with MADV_HUGEPAGE;
+// smaller ones use the 64-byte aligned operator new. This is the minimal part of task_5's HugePageAllocator: the
+// one-shot sort needs neither the MAP_HUGETLB pool, prefaulting nor per-buffer settings, and each task stays a
+// standalone single-file project
+const size_t HUGE_PAGE_BYTES = size_t{2} << 20;
+const size_t BUFFER_ALIGNMENT = 64;
+
+size_t large_buffer_bytes(size_t bytes) {
+    return (bytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+}
+
+void* allocate_buffer(size_t bytes) {
+    if (bytes < HUGE_PAGE_BYTES) {
+        return ::operator new(bytes, std::align_val_t(BUFFER_ALIGNMENT));
+    }
+
+    // Over-map by one huge page and trim so the buffer starts on a 2 MB boundary
+    size_t length = large_buffer_bytes(bytes);
+    void* raw = ::mmap(nullptr, length + HUGE_PAGE_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t aligned = (start + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+    if (aligned > start) {
+        ::munmap(raw, aligned - start);
+    }
+    size_t tail = start + length + HUGE_PAGE_BYTES - (aligned + length);
+    if (tail > 0) {
+        ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    ::madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+}
+
+void free_buffer(void* buffer, size_t bytes) {
+    if (bytes < HUGE_PAGE_BYTES) {
+        ::operator delete(buffer, std::align_val_t(BUFFER_ALIGNMENT));
+        return;
+    }
+    ::munmap(buffer, large_buffer_bytes(bytes));
+}
+
+// Transparent huge pages this process actually got (AnonHugePages in /proc/self/smaps_rollup)
+size_t anon_huge_page_bytes() {
+    std::ifstream rollup("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(rollup, line)) {
+        if (line.compare(0, 14, "AnonHugePages:") == 0) {
+            return std::strtoull(line.c_str() + 14, nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+
+template <typename T>
+struct HugePageAllocator {
+    using value_type = T;
+
+    HugePageAllocator() = default;
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(allocate_buffer(count * sizeof(T)));
+    }
+
+    void deallocate(T* buffer, size_t count) {
+        free_buffer(buffer, count * sizeof(T));
+    }
+
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>&) const {
+        return false;
+    }
+};
+
+template <typename T>
+using LargeBuffer = std::vector<T, HugePageAllocator<T>>;
+
 class SegmentProcessor {
 private:
     Logger& logger;
@@ -93,26 +413,40 @@ public:
             return {0, {}};
         }
 
-        logger.info("Validating segments data");
-        for (size_t i = 0; i < segments.size(); ++i) {
-            const auto& segment = segments[i];
-            if (segment.first > segment.second) {
-                std::string error_msg = "Segment " + std::to_string(i) + 
-                    " has start > end: (" + std::to_string(segment.first) + 
-                    ", " + std::to_string(segment.second) + ")";
-                logger.error(error_msg);
-                throw std::invalid_argument(error_msg);
-            }
+        if (segments.size() > SORT_KEY_MAX_SEGMENTS) {
+            std::string error_msg = "Too many segments: " + std::to_string(segments.size()) +
+                " (sort keys hold indices below " + std::to_string(SORT_KEY_MAX_SEGMENTS) + ")";
+            logger.error(error_msg);
+            throw std::invalid_argument(error_msg);
+        }
+
+        const SegmentKernels& kernels = segment_kernels();
+        logger.info(std::string("Validating segments data (") + cpu_level_name(kernels.level) + " kernels)");
+        size_t invalid = kernels.find_invalid(segments.data(), segments.size());
+        if (invalid < segments.size()) {
+            const auto& segment = segments[invalid];
+            std::string error_msg = "Segment " + std::to_string(invalid) + 
+                " has start > end: (" + std::to_string(segment.first) + 
+                ", " + std::to_string(segment.second) + ")";
+            logger.error(error_msg);
+            throw std::invalid_argument(error_msg);
         }
         logger.info("Segments validation completed successfully");
 
         // Sort segments by right endpoint
         logger.info("Sorting segments by right endpoint");
-        std::vector<std::pair<int, int>> sorted_segments = segments;
-        std::sort(sorted_segments.begin(), sorted_segments.end(),
-            [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
-                return a.second < b.second;
-            });
+        LargeBuffer<uint64_t> sort_keys(segments.size());
+        kernels.build_sort_keys(segments.data(), segments.size(), sort_keys.data());
+        std::sort(sort_keys.begin(), sort_keys.end());
+
+        LargeBuffer<std::pair<int, int>> sorted_segments(segments.size());
+        if (sort_keys.size() * sizeof(uint64_t) >= HUGE_PAGE_BYTES) {
+            logger.info("Sort buffers: " + std::to_string(segments.size() * (sizeof(uint64_t) + sizeof(segments[0]))) +
+                        " bytes, transparent huge pages in use: " + std::to_string(anon_huge_page_bytes()) + " bytes");
+        }
+        for (size_t i = 0; i < sort_keys.size(); ++i) {
+            sorted_segments[i] = segments[static_cast<uint32_t>(sort_keys[i])];
+        }
         logger.info("Segments sorted successfully");
 
         std::vector<int> selected_points;
@@ -251,7 +585,7 @@ public:
         logger.info("Lines processed: " + std::to_string(lines_read));
         logger.info("Empty lines skipped: " + std::to_string(lines_skipped));
 
-        if (segments_data.size() != total_segments_count) {
+        if (segments_data.size() != static_cast<size_t>(total_segments_count)) {
             logger.warning("Segment count mismatch: expected " + 
                           std::to_string(total_segments_count) + ", got " + 
                           std::to_string(segments_data.size()));
@@ -313,7 +647,109 @@ public:
     }
 };
 
-int main() {
+// Peak resident set (VmHWM) of this process image in KB, 0 where unavailable
+size_t peak_resident_memory_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+// Machine-readable solve for benchmark_compare.py: logging off, result and solve time on stdout
+int solve_segments_quiet(const std::string& filename) {
+    Logger logger("task.log", false);
+    logger.set_enabled(false);
+    FileReader file_reader(logger);
+    SegmentProcessor segment_processor(logger);
+    auto segments = file_reader.read_segments_from_file(filename);
+
+    auto start = std::chrono::steady_clock::now();
+    auto result = segment_processor.find_minimum_points_to_cover_all_segments(segments);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "count " << result.first << "\npoints";
+    for (int point : result.second) {
+        std::cout << ' ' << point;
+    }
+    std::cout << "\nseconds " << seconds << "\npeak_kb " << peak_resident_memory_kb() << std::endl;
+    return 0;
+}
+
+// Every level this CPU supports is compared with the scalar kernels, whatever SEGMENTS_CPU_LEVEL binds for the solver
+bool run_segment_kernel_tests(Logger& logger) {
+    logger.info("Verifying vectorized segment kernels against the scalar ones");
+
+    std::mt19937 generator(2024);
+    std::uniform_int_distribution<int> coordinate(-1000, 1000);
+    const SegmentKernels scalar = segment_kernels_for(CpuLevel::Scalar);
+    CpuLevel detected = detect_cpu_level();
+    bool passed = true;
+
+    for (CpuLevel level : {CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512}) {
+        if (level > detected) break;
+        const SegmentKernels kernels = segment_kernels_for(level);
+        bool level_passed = true;
+
+        // Counts below, at and around every vector width, so the scalar tails are exercised too
+        for (size_t count : {0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 33, 100, 1001}) {
+            std::vector<std::pair<int, int>> segments(count);
+            for (auto& segment : segments) {
+                int a = coordinate(generator);
+                int b = coordinate(generator);
+                segment = {std::min(a, b), std::max(a, b)};
+            }
+            if (count >= 2) {
+                segments[0] = {std::numeric_limits<int>::min(), std::numeric_limits<int>::max()};
+                segments[count - 1] = {-1, -1};
+            }
+
+            std::vector<uint64_t> expected(count), actual(count);
+            scalar.build_sort_keys(segments.data(), count, expected.data());
+            kernels.build_sort_keys(segments.data(), count, actual.data());
+            level_passed = level_passed && expected == actual;
+            level_passed = level_passed && kernels.find_invalid(segments.data(), count) == count;
+
+            // One invalid segment at each position (first, last and everything between), then two at once
+            for (size_t invalid = 0; invalid < count; ++invalid) {
+                auto broken = segments;
+                broken[invalid] = {1, 0};
+                level_passed = level_passed && kernels.find_invalid(broken.data(), count) == invalid &&
+                               scalar.find_invalid(broken.data(), count) == invalid;
+                if (invalid + 1 < count) {
+                    broken[count - 1] = {1, 0};
+                    level_passed = level_passed && kernels.find_invalid(broken.data(), count) == invalid;
+                }
+            }
+        }
+
+        logger.info(std::string(cpu_level_name(level)) + " kernels: " + (level_passed ? "PASS" : "FAIL"));
+        passed = passed && level_passed;
+    }
+
+    logger.info(std::string("Detected CPU level: ") + cpu_level_name(detected) + ", solver uses: " +
+                cpu_level_name(segment_kernels().level));
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::string(argv[1]) == "--solve-quiet") {
+        try {
+            return solve_segments_quiet(argv[2]);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    if (argc == 2 && std::string(argv[1]) == "--self-test") {
+        Logger logger("task.log", false);
+        return run_segment_kernel_tests(logger) ? 0 : 1;
+    }
+
     try {
         Logger logger("task.log", false);
         ProcessingPipeline pipeline(logger);
@@ -322,15 +758,12 @@ int main() {
         
         if (result.first != -1) {
             logger.info("Final result: " + std::to_string(result.first) + " points");
-            for (size_t i = 0; i < result.second.size(); ++i) {
-                if (i > 0) std::cout << ", ";
-            }
         } else {
-            logger.error("Processing failed. Check log for details" + std::string(e.what()));
+            logger.error("Processing failed. Check log for details");
         }
 
     } catch (const std::exception& e) {
-        logger.error("Critical error in main execution" + std::string(e.what()));
+        std::cerr << "Critical error in main execution: " << e.what() << std::endl;
         return 1;
     }
 
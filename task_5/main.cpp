@@ -8,14 +8,56 @@
 #include <chrono>
 #include <fstream>
 #include <memory>
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <stdexcept>
+#include <exception>
+#include <cmath>
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <cstdlib>
+#include <filesystem>
+#include <type_traits>
+#include <queue>
+#include <set>
+#include <deque>
+#include <array>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TRIANGLE_X86_DISPATCH 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+// Build with -DTRIANGLE_PROGRESS=0 to remove the progress hooks from minimum_total
+#ifndef TRIANGLE_PROGRESS
+#define TRIANGLE_PROGRESS 1
+#endif
 
 class Logger {
 private:
     std::ofstream file_stream;
     bool log_to_file;
+    bool enabled = true;
+    bool buffer_messages;
+    std::string buffer;
     
 public:
-    Logger(bool to_file = true) : log_to_file(to_file) {
+    // A buffered logger keeps messages in memory until take_buffer() instead of being printed
+    Logger(bool to_file = true, bool buffered = false) : log_to_file(to_file), buffer_messages(buffered) {
         if (log_to_file) {
             file_stream.open("triangle_path.log", std::ios::out);
         }
@@ -43,18 +85,49 @@ public:
         log("DEBUG", message);
     }
     
+    void set_enabled(bool value) {
+        enabled = value;
+    }
+    
+    // For messages that are costly to build: check first, so a disabled logger costs nothing per call
+    bool is_enabled() const {
+        return enabled;
+    }
+    
+    std::string take_buffer() {
+        std::string text;
+        text.swap(buffer);
+        return text;
+    }
+    
+    // Writes already formatted lines, e.g. the buffer of another logger
+    void write_block(const std::string& text) {
+        if (!enabled || text.empty()) return;
+        std::cout << text << std::flush;
+        if (log_to_file && file_stream.is_open()) {
+            file_stream << text << std::flush;
+        }
+    }
+    
 private:
     void log(const std::string& level, const std::string& message) {
+        if (!enabled) return;
+        
         auto now = std::chrono::system_clock::now();
         auto time_t = std::chrono::system_clock::to_time_t(now);
         
-        std::stringstream ss;
-        ss << std::ctime(&time_t);
-        std::string time_str = ss.str();
+        char time_buffer[32];
+        std::string time_str = ctime_r(&time_t, time_buffer);
         time_str.pop_back();
         
         std::string log_message = time_str + " - " + level + " - " + message;
         
+        if (buffer_messages) {
+            buffer += log_message;
+            buffer += '\n';
+            return;
+        }
+        
         std::cout << log_message << std::endl;
         if (log_to_file && file_stream.is_open()) {
             file_stream << log_message << std::endl;
@@ -98,286 +171,5410 @@ const std::string LogMessages::TEST_FAILED = "Test FAILED";
 const std::string LogMessages::GENERATION_START = "Generating random test case ";
 const std::string LogMessages::GENERATION_COMPLETE = "Generated triangle: ";
 
-std::string vectorToString(const std::vector<int>& vec) {
-    std::stringstream ss;
-    ss << "[";
-    for (size_t i = 0; i < vec.size(); ++i) {
-        ss << vec[i];
-        if (i < vec.size() - 1) ss << ", ";
+// Formatting writes through a sink: any callable taking std::string_view. Numbers go through std::to_chars
+// into a stack chunk, so nothing is allocated unless the sink allocates. At most max_items values are
+// written; the rest are summarised as "... (N more)"
+constexpr size_t FORMAT_ALL = std::numeric_limits<size_t>::max();
+constexpr size_t DEFAULT_FORMAT_ITEMS = 16;
+constexpr size_t DEFAULT_FORMAT_ROWS = 8;
+
+template <typename Sink>
+class ChunkWriter {
+private:
+    Sink& sink;
+    char chunk[256];
+    size_t used = 0;
+
+public:
+    explicit ChunkWriter(Sink& target) : sink(target) {}
+
+    ~ChunkWriter() {
+        flush();
     }
-    ss << "]";
-    return ss.str();
-}
 
-std::string triangleToString(const std::vector<std::vector<int>>& triangle) {
-    std::stringstream ss;
-    ss << "[";
-    for (size_t i = 0; i < triangle.size(); ++i) {
-        ss << "[";
-        for (size_t j = 0; j < triangle[i].size(); ++j) {
-            ss << triangle[i][j];
-            if (j < triangle[i].size() - 1) ss << ", ";
+    void flush() {
+        if (used > 0) sink(std::string_view(chunk, used));
+        used = 0;
+    }
+
+    void put(std::string_view text) {
+        if (used + text.size() > sizeof(chunk)) flush();
+        if (text.size() > sizeof(chunk)) {
+            sink(text);
+            return;
         }
-        ss << "]";
-        if (i < triangle.size() - 1) ss << ", ";
+        std::memcpy(chunk + used, text.data(), text.size());
+        used += text.size();
+    }
+
+    template <typename T>
+    void put_number(T value) {
+        char number[24];
+        auto result = std::to_chars(number, number + sizeof(number), value);
+        put(std::string_view(number, result.ptr - number));
+    }
+
+    void put_more(size_t hidden) {
+        put("... (");
+        put_number(hidden);
+        put(" more)");
+    }
+};
+
+template <typename Sink, typename T>
+void write_values(ChunkWriter<Sink>& writer, const T* values, size_t count, std::string_view separator, size_t max_items) {
+    size_t shown = std::min(count, max_items);
+    for (size_t i = 0; i < shown; ++i) {
+        if (i > 0) writer.put(separator);
+        writer.put_number(values[i]);
+    }
+    if (shown < count) {
+        if (shown > 0) writer.put(separator);
+        writer.put_more(count - shown);
     }
-    ss << "]";
-    return ss.str();
 }
 
-std::string pathToString(const std::vector<int>& path) {
-    std::stringstream ss;
-    for (size_t i = 0; i < path.size(); ++i) {
-        ss << path[i];
-        if (i < path.size() - 1) ss << " -> ";
+// [a, b, c]
+template <typename Sink, typename T>
+void write_vector(Sink&& sink, const std::vector<T>& values, size_t max_items = FORMAT_ALL) {
+    ChunkWriter<std::remove_reference_t<Sink>> writer(sink);
+    writer.put("[");
+    write_values(writer, values.data(), values.size(), ", ", max_items);
+    writer.put("]");
+}
+
+// a -> b -> c
+template <typename Sink, typename T>
+void write_path(Sink&& sink, const std::vector<T>& path, size_t max_items = FORMAT_ALL) {
+    ChunkWriter<std::remove_reference_t<Sink>> writer(sink);
+    write_values(writer, path.data(), path.size(), " -> ", max_items);
+}
+
+// [[a], [b, c], ...]
+template <typename Sink, typename T>
+void write_triangle(Sink&& sink, const std::vector<std::vector<T>>& triangle,
+                    size_t max_rows = FORMAT_ALL, size_t max_items = FORMAT_ALL) {
+    ChunkWriter<std::remove_reference_t<Sink>> writer(sink);
+    writer.put("[");
+    size_t shown = std::min(triangle.size(), max_rows);
+    for (size_t i = 0; i < shown; ++i) {
+        if (i > 0) writer.put(", ");
+        writer.put("[");
+        write_values(writer, triangle[i].data(), triangle[i].size(), ", ", max_items);
+        writer.put("]");
+    }
+    if (shown < triangle.size()) {
+        if (shown > 0) writer.put(", ");
+        writer.put_more(triangle.size() - shown);
     }
-    return ss.str();
+    writer.put("]");
 }
 
-std::pair<int, std::vector<int>> minimum_total(const std::vector<std::vector<int>>& triangle, Logger& logger) {
-    try {
-        logger.info(LogMessages::ALGORITHM_START);
+// Sink over a caller-provided buffer; output past the capacity is dropped and marked as truncated
+class BufferSink {
+private:
+    char* data;
+    size_t capacity;
+    size_t length = 0;
+    bool overflowed = false;
 
-        if (triangle.empty() || triangle[0].empty()) {
-            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
-            return {0, {}};
-        }
+public:
+    BufferSink(char* buffer, size_t buffer_capacity) : data(buffer), capacity(buffer_capacity) {}
 
-        int n = triangle.size();
-        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+    void operator()(std::string_view text) {
+        size_t count = std::min(text.size(), capacity - length);
+        std::memcpy(data + length, text.data(), count);
+        length += count;
+        overflowed = overflowed || count < text.size();
+    }
 
-        
-        std::vector<std::vector<int>> dp(n);
-        for (int i = 0; i < n; ++i) {
-            dp[i].resize(triangle[i].size());
-        }
+    std::string_view view() const {
+        return std::string_view(data, length);
+    }
 
-        for (size_t j = 0; j < triangle[n-1].size(); ++j) {
-            dp[n-1][j] = triangle[n-1][j];
-        }
+    bool truncated() const {
+        return overflowed;
+    }
+};
 
-        logger.info(LogMessages::DP_INITIALIZATION + vectorToString(dp[n-1]));
+// Full dumps straight to a stream, e.g. write_triangle(StreamSink{file}, triangle)
+struct StreamSink {
+    std::ostream& out;
 
-        for (int i = n-2; i >= 0; --i) {
-            for (size_t j = 0; j < triangle[i].size(); ++j) {
-                dp[i][j] = triangle[i][j] + std::min(dp[i+1][j], dp[i+1][j+1]);
-                
-                std::string debug_msg = LogMessages::DP_UPDATE + 
-                    std::to_string(j) + "] = min(" + 
-                    std::to_string(triangle[i][j]) + " + " + std::to_string(dp[i+1][j]) + ", " +
-                    std::to_string(triangle[i][j]) + " + " + std::to_string(dp[i+1][j+1]) + ") = " +
-                    std::to_string(dp[i][j]);
-                logger.debug(debug_msg);
-            }
+    void operator()(std::string_view text) {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+};
+
+struct StringSink {
+    std::string& out;
+
+    void operator()(std::string_view text) {
+        out.append(text.data(), text.size());
+    }
+};
+
+// Thread-local ring of buffers for log messages; a returned view stays valid for the next
+// FORMAT_RING_SLOTS - 1 format_* calls on the same thread, so several can be used in one expression
+constexpr size_t FORMAT_RING_SLOTS = 4;
+constexpr size_t FORMAT_BUFFER_BYTES = 4096;
+
+BufferSink next_format_buffer() {
+    thread_local char buffers[FORMAT_RING_SLOTS][FORMAT_BUFFER_BYTES];
+    thread_local size_t next_slot = 0;
+    char* buffer = buffers[next_slot];
+    next_slot = (next_slot + 1) % FORMAT_RING_SLOTS;
+    return BufferSink(buffer, FORMAT_BUFFER_BYTES);
+}
+
+std::string_view format_vector(const int* values, size_t count, size_t max_items = DEFAULT_FORMAT_ITEMS) {
+    BufferSink sink = next_format_buffer();
+    ChunkWriter<BufferSink> writer(sink);
+    writer.put("[");
+    write_values(writer, values, count, ", ", max_items);
+    writer.put("]");
+    writer.flush();
+    return sink.view();
+}
+
+std::string_view format_vector(const std::vector<int>& vec, size_t max_items = DEFAULT_FORMAT_ITEMS) {
+    return format_vector(vec.data(), vec.size(), max_items);
+}
+
+std::string_view format_path(const std::vector<int>& path, size_t max_items = DEFAULT_FORMAT_ITEMS) {
+    BufferSink sink = next_format_buffer();
+    write_path(sink, path, max_items);
+    return sink.view();
+}
+
+std::string_view format_triangle(const std::vector<std::vector<int>>& triangle,
+                                 size_t max_rows = DEFAULT_FORMAT_ROWS, size_t max_items = DEFAULT_FORMAT_ITEMS) {
+    BufferSink sink = next_format_buffer();
+    write_triangle(sink, triangle, max_rows, max_items);
+    return sink.view();
+}
+
+// Unbounded forms, kept for callers that need the whole text
+std::string vectorToString(const std::vector<int>& vec) {
+    std::string text;
+    write_vector(StringSink{text}, vec);
+    return text;
+}
+
+std::string triangleToString(const std::vector<std::vector<int>>& triangle) {
+    std::string text;
+    write_triangle(StringSink{text}, triangle);
+    return text;
+}
+
+std::string pathToString(const std::vector<int>& path) {
+    std::string text;
+    write_path(StringSink{text}, path);
+    return text;
+}
+
+// Large working buffers (dp table, choice bits) are mapped on 2 MB boundaries so the kernel can back them with huge
+// pages: explicit ones via MAP_HUGETLB when a pool is configured, transparent ones via MADV_HUGEPAGE otherwise.
+// Smaller buffers come from the aligned operator new. Every buffer is at least 64-byte aligned for the SIMD kernels
+constexpr size_t HUGE_PAGE_BYTES = size_t{2} << 20;
+constexpr size_t BUFFER_ALIGNMENT = 64;
+
+struct HugePageSettings {
+    bool request_huge_pages = true;
+    bool try_explicit_pages = true;    // MAP_HUGETLB first; fails fast when no pages are reserved
+    bool prefault = false;             // touch every page up front, split across threads
+};
+
+struct HugePageStats {
+    std::atomic<size_t> explicit_allocations{0};   // backed by MAP_HUGETLB pages
+    std::atomic<size_t> advised_allocations{0};    // anonymous mapping advised with MADV_HUGEPAGE
+    std::atomic<size_t> regular_allocations{0};    // large mapping without huge page request, or advice refused
+    std::atomic<size_t> small_allocations{0};
+    std::atomic<size_t> mapped_bytes{0};           // currently held by large allocations
+};
+
+HugePageStats& huge_page_stats() {
+    static HugePageStats stats;
+    return stats;
+}
+
+size_t large_buffer_bytes(size_t bytes) {
+    return (bytes + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+}
+
+void prefault_buffer(void* buffer, size_t bytes) {
+    size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t thread_count = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()),
+                                           std::max<size_t>(1, bytes / HUGE_PAGE_BYTES));
+    char* base = static_cast<char*>(buffer);
+    auto touch = [&](size_t part) {
+        size_t begin = bytes * part / thread_count / page * page;
+        size_t end = bytes * (part + 1) / thread_count / page * page;
+        for (size_t offset = begin; offset < end; offset += page) {
+            base[offset] = 0;
         }
+    };
 
-        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
-        std::vector<int> path;
-        int current_col = 0;
-        path.push_back(triangle[0][current_col]);
+    std::vector<std::thread> threads;
+    for (size_t part = 1; part < thread_count; ++part) {
+        threads.emplace_back(touch, part);
+    }
+    touch(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
 
-        for (int i = 1; i < n; ++i) {
-            int expected_value = dp[i-1][current_col] - triangle[i-1][current_col];
-            
-            if (dp[i][current_col] == expected_value) {
-                path.push_back(triangle[i][current_col]);
-            } else {
-                current_col += 1;
-                path.push_back(triangle[i][current_col]);
-            }
+void* allocate_buffer(size_t bytes, const HugePageSettings& settings) {
+    if (bytes < HUGE_PAGE_BYTES) {
+        huge_page_stats().small_allocations.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(bytes, std::align_val_t(BUFFER_ALIGNMENT));
+    }
+
+    size_t length = large_buffer_bytes(bytes);
+    void* buffer = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    if (settings.request_huge_pages && settings.try_explicit_pages) {
+        buffer = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (buffer != MAP_FAILED) {
+            huge_page_stats().explicit_allocations.fetch_add(1, std::memory_order_relaxed);
         }
+    }
+#endif
 
-        int min_sum = dp[0][0];
-        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
-        logger.info(LogMessages::PATH_COMPLETE + pathToString(path));
+    if (buffer == MAP_FAILED) {
+        // Over-map by one huge page and trim so the buffer starts on a 2 MB boundary
+        void* raw = ::mmap(nullptr, length + HUGE_PAGE_BYTES, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+        uintptr_t aligned = (start + HUGE_PAGE_BYTES - 1) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+        if (aligned > start) {
+            ::munmap(raw, aligned - start);
+        }
+        size_t tail = start + length + HUGE_PAGE_BYTES - (aligned + length);
+        if (tail > 0) {
+            ::munmap(reinterpret_cast<void*>(aligned + length), tail);
+        }
+        buffer = reinterpret_cast<void*>(aligned);
 
-        return {min_sum, path};
+        bool advised = false;
+#if defined(MADV_HUGEPAGE)
+        advised = settings.request_huge_pages && ::madvise(buffer, length, MADV_HUGEPAGE) == 0;
+#endif
+        (advised ? huge_page_stats().advised_allocations : huge_page_stats().regular_allocations)
+            .fetch_add(1, std::memory_order_relaxed);
+    }
 
-    } catch (const std::exception& error) {
-        logger.error("Error in minimum path calculation: " + std::string(error.what()));
-        return {std::numeric_limits<int>::max(), {}};
+    huge_page_stats().mapped_bytes.fetch_add(length, std::memory_order_relaxed);
+    if (settings.prefault) {
+        prefault_buffer(buffer, length);
     }
+    return buffer;
 }
 
-class TriangleGenerator {
-private:
-    std::random_device rd;
-    std::mt19937 gen;
-    
-public:
-    TriangleGenerator() : gen(rd()) {}
-    
-    std::vector<std::vector<int>> generate_random_triangle(int rows, int min_val = -10, int max_val = 10) {
-        Logger logger(false);
-        logger.info(LogMessages::GENERATION_START + std::to_string(rows) + " with " + std::to_string(rows) + " rows");
-        
-        std::vector<std::vector<int>> triangle;
-        std::uniform_int_distribution<int> dis(min_val, max_val);
-        
-        for (int i = 0; i < rows; ++i) {
-            std::vector<int> row;
-            for (int j = 0; j <= i; ++j) {
-                row.push_back(dis(gen));
-            }
-            triangle.push_back(row);
+void free_buffer(void* buffer, size_t bytes) {
+    if (bytes < HUGE_PAGE_BYTES) {
+        ::operator delete(buffer, std::align_val_t(BUFFER_ALIGNMENT));
+        return;
+    }
+    size_t length = large_buffer_bytes(bytes);
+    ::munmap(buffer, length);
+    huge_page_stats().mapped_bytes.fetch_sub(length, std::memory_order_relaxed);
+}
+
+// AnonHugePages of this process from /proc/self/smaps_rollup: transparent huge pages actually in use
+size_t anon_huge_page_bytes() {
+    std::ifstream rollup("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(rollup, line)) {
+        if (line.compare(0, 14, "AnonHugePages:") == 0) {
+            return std::strtoull(line.c_str() + 14, nullptr, 10) * 1024;
         }
-        
-        logger.info(LogMessages::GENERATION_COMPLETE + triangleToString(triangle));
-        return triangle;
     }
-};
+    return 0;
+}
 
-struct TestCase {
-    std::string name;
-    std::vector<std::vector<int>> triangle;
-    int expected_sum;
-    std::vector<int> expected_path;
-};
+std::string huge_page_report() {
+    const HugePageStats& stats = huge_page_stats();
+    return "explicit huge page buffers: " + std::to_string(stats.explicit_allocations.load()) +
+           ", THP-advised buffers: " + std::to_string(stats.advised_allocations.load()) +
+           ", regular large buffers: " + std::to_string(stats.regular_allocations.load()) +
+           ", transparent huge pages in use: " + std::to_string(anon_huge_page_bytes()) + " bytes";
+}
 
-class TriangleTests {
-public:
-    static std::vector<TestCase> get_basic_tests() {
-        return {
-            {"Basic Triangle 1", {{2}, {3, 4}, {6, 5, 7}, {4, 1, 8, 3}}, 11, {2, 3, 5, 1}},
-            {"Basic Triangle 2", {{-1}, {2, 3}, {1, -1, -3}, {4, 2, 1, 3}}, 0, {-1, 3, -3, 1}}
-        };
+// The settings travel with each allocator (and so with each LargeBuffer) instead of living in a global, so one
+// buffer can ask for prefaulting without affecting allocations made concurrently by other threads
+template <typename T>
+struct HugePageAllocator {
+    using value_type = T;
+
+    HugePageSettings settings;
+
+    HugePageAllocator() = default;
+
+    explicit HugePageAllocator(const HugePageSettings& buffer_settings) : settings(buffer_settings) {}
+
+    template <typename U>
+    HugePageAllocator(const HugePageAllocator<U>& other) : settings(other.settings) {}
+
+    T* allocate(size_t count) {
+        if (count > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(allocate_buffer(count * sizeof(T), settings));
     }
-    
-    static std::vector<TestCase> get_edge_tests() {
-        return {
-            {"Single Element", {{5}}, 5, {5}},
-            {"Two Rows", {{1}, {2, 3}}, 3, {1, 2}},
-            {"All Same Values", {{1}, {1, 1}, {1, 1, 1}}, 3, {1, 1, 1}},
-            {"Negative Values", {{-1}, {-2, -3}, {-4, -5, -6}}, -10, {-1, -3, -6}}
-        };
+
+    void deallocate(T* buffer, size_t count) {
+        free_buffer(buffer, count * sizeof(T));
     }
-    
-    static std::vector<TestCase> get_large_tests() {
-        return {
-            {"5x5 Triangle", {{1}, {2, 3}, {4, 5, 6}, {7, 8, 9, 10}, {11, 12, 13, 14, 15}}, 
-             1 + 2 + 4 + 7 + 11, {1, 2, 4, 7, 11}}
-        };
+
+    // Any allocator can free any buffer: the release path does not depend on the settings
+    template <typename U>
+    bool operator==(const HugePageAllocator<U>&) const {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const HugePageAllocator<U>&) const {
+        return false;
     }
 };
 
-struct TestResult {
-    std::string name;
-    bool passed;
-    int actual_sum;
-    std::vector<int> actual_path;
+template <typename T>
+using LargeBuffer = std::vector<T, HugePageAllocator<T>>;
+
+struct ProgressSnapshot {
+    size_t rows_done;
+    size_t total_rows;
+    uint64_t cells_done;
+    double cells_per_second;    // over the sliding window
+    double elapsed_seconds;
 };
 
-TestResult run_test(const TestCase& test_case, int test_number, Logger& logger) {
-    logger.info(LogMessages::TEST_START + std::to_string(test_number));
-    
-    auto [actual_sum, actual_path] = minimum_total(test_case.triangle, logger);
-    
-    bool sum_correct = (actual_sum == test_case.expected_sum);
-    bool path_correct = (actual_path == test_case.expected_path);
-    bool passed = sum_correct && path_correct;
-    
-    if (passed) {
-        logger.info(LogMessages::TEST_PASSED);
-    } else {
-        logger.info(LogMessages::TEST_FAILED);
+// Row-granular progress of one solve. The solving thread calls begin()/row_done(); the counters can be read
+// from any other thread while it runs. The rate is measured over the last WINDOW_SAMPLES samples, taken
+// every sample_every_rows rows, so a slowdown shows up instead of being averaged away
+class ProgressMonitor {
+public:
+    using Callback = std::function<void(const ProgressSnapshot&)>;
+    static constexpr size_t WINDOW_SAMPLES = 16;
+
+    explicit ProgressMonitor(size_t callback_every_rows = 0, Callback on_progress = Callback(),
+                             size_t sample_every_rows = 64)
+        : callback_every(callback_every_rows), callback(std::move(on_progress)),
+          sample_every(std::max<size_t>(sample_every_rows, 1)) {}
+
+    void begin(size_t row_count) {
+        auto now = std::chrono::steady_clock::now();
+        start_ns.store(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count(),
+                       std::memory_order_relaxed);
+        total.store(row_count, std::memory_order_relaxed);
+        rows.store(0, std::memory_order_relaxed);
+        cells.store(0, std::memory_order_relaxed);
+        rate.store(0.0, std::memory_order_relaxed);
+        samples[0] = {now, 0};
+        sample_count = 1;
     }
-    
-    std::string result_msg = LogMessages::TEST_RESULT + 
-        std::to_string(test_number) + ": Expected sum = " + std::to_string(test_case.expected_sum) +
-        ", Got = " + std::to_string(actual_sum) + " | Expected path = " + 
-        pathToString(test_case.expected_path) + ", Got = " + pathToString(actual_path);
-    logger.info(result_msg);
-    
-    return {test_case.name, passed, actual_sum, actual_path};
-}
 
-std::vector<TestResult> run_test_suite(Logger& logger) {
-    logger.info("RUNNING COMPREHENSIVE TEST SUITE");
-    
-    std::vector<TestResult> results;
-    std::vector<TestCase> all_tests;
-    
-    auto basic_tests = TriangleTests::get_basic_tests();
-    all_tests.insert(all_tests.end(), basic_tests.begin(), basic_tests.end());
-    
-    auto edge_tests = TriangleTests::get_edge_tests();
-    all_tests.insert(all_tests.end(), edge_tests.begin(), edge_tests.end());
-    
-    auto large_tests = TriangleTests::get_large_tests();
-    all_tests.insert(all_tests.end(), large_tests.begin(), large_tests.end());
-    
-    for (size_t i = 0; i < all_tests.size(); ++i) {
-        results.push_back(run_test(all_tests[i], i + 1, logger));
+    void row_done(size_t row_cells) {
+        size_t done = rows.fetch_add(1, std::memory_order_relaxed) + 1;
+        uint64_t cell_total = cells.fetch_add(row_cells, std::memory_order_relaxed) + row_cells;
+
+        bool sample_due = done % sample_every == 0;
+        bool callback_due = callback_every > 0 && callback && done % callback_every == 0;
+        if (sample_due || callback_due) {
+            take_sample(cell_total);
+        }
+        if (callback_due) {
+            callback(snapshot());
+        }
     }
-    
-    TriangleGenerator generator;
-    for (int i = 0; i < 3; ++i) {
-        int rows = 3 + (i * 2); // 3, 5, 7 rows
-        auto triangle = generator.generate_random_triangle(rows);
-        
-        auto [expected_sum, expected_path] = minimum_total(triangle, logger);
-        
-        TestCase random_test = {
-            "Random Test " + std::to_string(i + 1),
-            triangle,
-            expected_sum,
-            expected_path
-        };
-        
-        results.push_back(run_test(random_test, all_tests.size() + i + 1, logger));
+
+    size_t rows_done() const {
+        return rows.load(std::memory_order_relaxed);
     }
-    
-    return results;
-}
 
-void print_test_summary(const std::vector<TestResult>& results, Logger& logger) {
-    logger.info("TEST SUMMARY");
-    
-    int passed_count = 0;
-    for (const auto& result : results) {
-        if (result.passed) passed_count++;
+    size_t total_rows() const {
+        return total.load(std::memory_order_relaxed);
     }
-    
-    int total_count = results.size();
-    
-    logger.info("Total Tests: " + std::to_string(total_count));
-    logger.info("Passed: " + std::to_string(passed_count));
-    logger.info("Failed: " + std::to_string(total_count - passed_count));
-    logger.info("Success Rate: " + std::to_string(static_cast<double>(passed_count) / total_count * 100) + "%");
-    
-    logger.info("Detailed Results:");
-    for (const auto& result : results) {
-        std::string status = result.passed ? "PASS" : "FAIL";
-        logger.info(result.name + " " + status + " Sum: " + std::to_string(result.actual_sum) + 
-                   " Path: " + pathToString(result.actual_path));
+
+    uint64_t cells_done() const {
+        return cells.load(std::memory_order_relaxed);
     }
-}
 
-void benchmark_algorithm(Logger& logger) {
-    logger.info("BENCHMARK WITH LARGE TRIANGLES");
+    double cells_per_second() const {
+        return rate.load(std::memory_order_relaxed);
+    }
+
+    ProgressSnapshot snapshot() const {
+        std::chrono::steady_clock::time_point start(std::chrono::nanoseconds(start_ns.load(std::memory_order_relaxed)));
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return {rows_done(), total_rows(), cells_done(), cells_per_second(), elapsed};
+    }
+
+private:
+    struct Sample {
+        std::chrono::steady_clock::time_point time;
+        uint64_t cells;
+    };
+
+    void take_sample(uint64_t cell_total) {
+        Sample now{std::chrono::steady_clock::now(), cell_total};
+        const Sample& oldest = samples[sample_count < WINDOW_SAMPLES ? 0 : sample_count % WINDOW_SAMPLES];
+        double seconds = std::chrono::duration<double>(now.time - oldest.time).count();
+        if (seconds > 0) {
+            rate.store((now.cells - oldest.cells) / seconds, std::memory_order_relaxed);
+        }
+        samples[sample_count % WINDOW_SAMPLES] = now;
+        ++sample_count;
+    }
+
+    size_t callback_every;
+    Callback callback;
+    size_t sample_every;
+    std::atomic<int64_t> start_ns{0};    // steady_clock nanoseconds, atomic like the counters since begin() may race snapshot()
+    std::atomic<size_t> rows{0};
+    std::atomic<size_t> total{0};
+    std::atomic<uint64_t> cells{0};
+    std::atomic<double> rate{0.0};
+    std::array<Sample, WINDOW_SAMPLES> samples{};
+    size_t sample_count = 0;
+};
+
+// Smallest and largest cell value of the rows added so far
+struct ValueRange {
+    int low = std::numeric_limits<int>::max();
+    int high = std::numeric_limits<int>::min();
+
+    void add(int value) {
+        low = std::min(low, value);
+        high = std::max(high, value);
+    }
+
+    int64_t max_abs() const {
+        return std::max(-static_cast<int64_t>(low), static_cast<int64_t>(high));
+    }
+};
+
+// Two's complement addition, as in a SIMD lane: wraps instead of overflowing
+inline int wrapping_add(int a, int b) {
+    return static_cast<int>(static_cast<unsigned>(a) + static_cast<unsigned>(b));
+}
+
+// Bitwise OR of every sum a row kernel wrote, kept per SIMD lane so the kernel merges its vector accumulator with
+// a plain load and store; bits() folds the lanes
+struct SumBits {
+    alignas(64) std::array<uint32_t, 16> lanes{};
+
+    void add(int value) {
+        lanes[0] |= static_cast<uint32_t>(value);
+    }
+
+    uint32_t bits() const {
+        uint32_t folded = 0;
+        for (uint32_t lane : lanes) folded |= lane;
+        return folded;
+    }
+};
+
+// Smallest sum a row kernel wrote and its leftmost column (relative to the kernel's out), kept per SIMD lane like
+// SumBits; each lane holds its own leftmost minimum and leftmost() picks among them. Covers one kernel call
+struct RowMinimum {
+    alignas(64) std::array<int, 16> values;
+    alignas(64) std::array<int, 16> columns{};
+
+    RowMinimum() {
+        values.fill(std::numeric_limits<int>::max());
+    }
+
+    // Columns must arrive in increasing order, as in the kernels' scalar tails
+    void add(int value, size_t column) {
+        if (value < values[0]) {
+            values[0] = value;
+            columns[0] = static_cast<int>(column);
+        }
+    }
+
+    std::pair<int, size_t> leftmost() const {
+        size_t best = 0;
+        for (size_t lane = 1; lane < values.size(); ++lane) {
+            if (values[lane] < values[best] || (values[lane] == values[best] && columns[lane] < columns[best])) {
+                best = lane;
+            }
+        }
+        return {values[best], static_cast<size_t>(columns[best])};
+    }
+};
+
+// Defined with the CPU dispatch below: out[j] = row[j] + min(below[j], below[j+1]), right-move bits into bits,
+// the new sums OR-ed into seen and their leftmost minimum kept in minimum
+inline void row_kernel(const int* row, const int* below, int* out, size_t width, uint64_t* bits,
+                       SumBits* seen = nullptr, RowMinimum* minimum = nullptr);
+
+// Move-set policies: column offsets allowed from row r to row r + 1, in tie-breaking order
+struct DownMoves {
+    static constexpr std::array<int, 2> deltas{{0, 1}};
+};
+
+struct ThreeWayMoves {
+    static constexpr std::array<int, 3> deltas{{-1, 0, 1}};
+};
+
+struct PyramidMoves {
+    static constexpr std::array<int, 3> deltas{{0, 1, 2}};
+};
+
+template <typename Moves>
+constexpr int min_move() {
+    int result = Moves::deltas[0];
+    for (int delta : Moves::deltas) result = std::min(result, delta);
+    return result;
+}
+
+template <typename Moves>
+constexpr int max_move() {
+    int result = Moves::deltas[0];
+    for (int delta : Moves::deltas) result = std::max(result, delta);
+    return result;
+}
+
+// Layout policies: row r holds columns [first(r), first(r) + width(r)) stored from offset(r) of a flat buffer
+struct TriangleLayout {
+    size_t rows;
+    size_t first(size_t) const { return 0; }
+    size_t width(size_t row) const { return row + 1; }
+    size_t offset(size_t row) const { return row * (row + 1) / 2; }
+};
+
+struct GridLayout {
+    size_t rows;
+    size_t cols;
+    size_t first(size_t) const { return 0; }
+    size_t width(size_t) const { return cols; }
+    size_t offset(size_t row) const { return row * cols; }
+};
+
+struct PyramidLayout {
+    size_t rows;
+    size_t first(size_t) const { return 0; }
+    size_t width(size_t row) const { return 2 * row + 1; }
+    size_t offset(size_t row) const { return row * row; }
+};
+
+// Grid restricted to columns within radius of the diagonal
+struct BandLayout {
+    size_t rows;
+    size_t cols;
+    size_t radius;
+    std::vector<size_t> offsets;
+
+    BandLayout(size_t row_count, size_t col_count, size_t band_radius)
+        : rows(row_count), cols(col_count), radius(band_radius), offsets(row_count + 1, 0) {
+        for (size_t row = 0; row < rows; ++row) {
+            offsets[row + 1] = offsets[row] + width(row);
+        }
+    }
+
+    size_t first(size_t row) const { return row > radius ? std::min(row - radius, cols - 1) : 0; }
+    size_t width(size_t row) const { return std::min(cols - 1, row + radius) - first(row) + 1; }
+    size_t offset(size_t row) const { return offsets[row]; }
+};
+
+struct GridPathResult {
+    int64_t sum = 0;
+    std::vector<size_t> columns;   // global column per row
+};
+
+// Move indices packed at 1 bit per cell for two moves and 2 bits for three or four, so the triangle keeps the
+// same one bit per cell as the other solvers. Rows start on a word boundary, as in PackedChoiceBits, so a row
+// kernel can store a row's choice words directly
+template <size_t MoveCount>
+class PackedMoveChoices {
+public:
+    static_assert(MoveCount >= 1 && MoveCount <= 4, "Up to four moves fit the packed choice encoding");
+    static constexpr size_t BITS = MoveCount <= 2 ? 1 : 2;
+
+    // Choices for the first row_count rows of layout
+    template <typename Layout>
+    PackedMoveChoices(const Layout& layout, size_t row_count) : row_offsets(row_count + 1, 0) {
+        for (size_t r = 0; r < row_count; ++r) {
+            row_offsets[r + 1] = row_offsets[r] + (layout.width(r) * BITS + 63) / 64;
+        }
+        words = LargeBuffer<uint64_t>(row_offsets.back());
+    }
+
+    uint64_t* row_words(size_t row) {
+        return words.data() + row_offsets[row];
+    }
+
+    void set(size_t row, size_t k, size_t move) {
+        if (move) row_words(row)[k * BITS / 64] |= uint64_t{move} << (k * BITS % 64);
+    }
+
+    // Packs count consecutive moves of row starting at column index k a whole word at a time
+    void set_range(size_t row, size_t k, const uint8_t* moves, size_t count) {
+        uint64_t* dst = row_words(row);
+        for (size_t i = 0; i < count; ) {
+            size_t bit = (k + i) * BITS;
+            size_t take = std::min(count - i, (64 - bit % 64) / BITS);
+            uint64_t packed = 0;
+            for (size_t t = 0; t < take; ++t) {
+                packed |= uint64_t{moves[i + t]} << (t * BITS);
+            }
+            dst[bit / 64] |= packed << (bit % 64);
+            i += take;
+        }
+    }
+
+    size_t get(size_t row, size_t k) const {
+        const uint64_t* src = words.data() + row_offsets[row];
+        return (src[k * BITS / 64] >> (k * BITS % 64)) & ((uint64_t{1} << BITS) - 1);
+    }
+
+    size_t memory_bytes() const {
+        return words.size() * sizeof(uint64_t) + row_offsets.size() * sizeof(size_t);
+    }
+
+private:
+    std::vector<size_t> row_offsets;
+    LargeBuffer<uint64_t> words;
+};
+
+// Called after each row r is finished with that row's sums, each stored plus offset
+struct NoRowObserver {
+    template <typename Sum>
+    void operator()(size_t, const Sum*, Sum) const {}
+};
+
+// Min-path dp over any layout and move set; the move list is a compile-time constant, so the interior loop is
+// fully unrolled and bounds checks only run on the few edge columns of each row. row_cells(r) returns the values
+// of row r, so nested and flat inputs are read in place. Sum = int keeps twice as many lanes per vector as the
+// int64_t default; std::overflow_error is thrown as soon as it could overflow, so the caller can rerun in int64_t
+template <typename Moves, typename Sum = int64_t, typename Layout, typename RowCells, typename RowObserver = NoRowObserver>
+GridPathResult min_path_dp_rows(const Layout& layout, const RowCells& row_cells_of,
+                                RowObserver&& observer = RowObserver()) {
+    constexpr size_t move_count = Moves::deltas.size();
+    constexpr int low = min_move<Moves>();
+    constexpr int high = max_move<Moves>();
+    constexpr bool int_down_moves = std::is_same<Moves, DownMoves>::value && std::is_same<Sum, int>::value;
+    const Sum unreachable = std::numeric_limits<Sum>::max() / 4;
+
+    GridPathResult result;
+    size_t rows = layout.rows;
+    if (rows == 0) return result;
+
+    // Down moves on int sums are exactly the triangle recurrence, so a layout whose every row is aligned with a
+    // wider row below it (the triangle) runs entirely on the dispatched SIMD row kernel
+    size_t max_width = 0;
+    bool kernel_rows = int_down_moves;
+    for (size_t r = 0; r < rows; ++r) {
+        max_width = std::max(max_width, layout.width(r));
+        if (r + 1 < rows && (layout.first(r) != layout.first(r + 1) || layout.width(r) >= layout.width(r + 1))) {
+            kernel_rows = false;
+        }
+    }
+
+    PackedMoveChoices<move_count> choices(layout, rows - 1);
+    const int* base = row_cells_of(rows - 1);
+    size_t base_width = layout.width(rows - 1);
+    std::vector<Sum> next(max_width);
+    Sum offset = 0;
+
+    if constexpr (int_down_moves) {
+        if (kernel_rows) {
+            // Sums are updated in place like the compact solver's rolling row, stored plus 2^29 so that every sum
+            // within +-2^29 lies in [0, 2^30). A kernel sum of two such values can only wrap to a value with bit
+            // 30 or 31 set, so the OR of the sums shows any that left the range; it keeps those bits, so checking
+            // it every 64 rows and at row 0 still discards any result built on them
+            offset = 1 << 29;
+            SumBits seen;
+            auto check_sums = [&] {
+                if (seen.bits() >> 30) {
+                    throw std::overflow_error("Path sums beyond +-" + std::to_string(offset) +
+                                              " may overflow int sums");
+                }
+            };
+            for (size_t k = 0; k < base_width; ++k) {
+                next[k] = wrapping_add(base[k], offset);
+                seen.add(next[k]);
+            }
+            check_sums();
+            for (size_t r = rows - 1; r-- > 0; ) {
+                row_kernel(row_cells_of(r), next.data(), next.data(), layout.width(r), choices.row_words(r), &seen);
+                if (r % 64 == 0) check_sums();
+                observer(r, next.data(), offset);
+            }
+        }
+    }
+
+    if (!kernel_rows) {
+        // Int rows off the kernel path are scanned before their sums are formed
+        ValueRange seen;
+        auto check_int_range = [&](const int* cells, size_t width) {
+            if constexpr (std::is_same<Sum, int>::value) {
+                for (size_t k = 0; k < width; ++k) seen.add(cells[k]);
+                if (seen.max_abs() * static_cast<int64_t>(rows) > std::numeric_limits<int>::max() / 4) {
+                    throw std::overflow_error("Values up to " + std::to_string(seen.max_abs()) + " over " +
+                                              std::to_string(rows) + " rows may overflow int sums");
+                }
+            } else {
+                (void)cells;
+                (void)width;
+            }
+        };
+
+        check_int_range(base, base_width);
+        std::copy(base, base + base_width, next.begin());
+        std::vector<Sum> current(max_width);
+        std::vector<uint8_t> row_moves(max_width);
+
+        for (size_t r = rows - 1; r-- > 0; ) {
+            size_t first = layout.first(r);
+            size_t width = layout.width(r);
+            long long next_first = layout.first(r + 1);
+            long long next_last = next_first + layout.width(r + 1) - 1;
+            const int* row_cells = row_cells_of(r);
+            check_int_range(row_cells, width);
+
+            auto edge_cell = [&](size_t k) {
+                long long col = first + k;
+                Sum best = unreachable;
+                size_t choice = 0;
+                for (size_t m = 0; m < move_count; ++m) {
+                    long long target = col + Moves::deltas[m];
+                    if (target >= next_first && target <= next_last && next[target - next_first] < best) {
+                        best = next[target - next_first];
+                        choice = m;
+                    }
+                }
+                current[k] = best == unreachable ? unreachable : row_cells[k] + best;
+                choices.set(r, k, choice);
+            };
+
+            long long interior_begin = std::max<long long>(first, next_first - low);
+            long long interior_end = std::min<long long>(first + width - 1, next_last - high) + 1;
+            if (interior_end < interior_begin) interior_end = interior_begin;
+            size_t k_begin = std::min<size_t>(width, interior_begin - first);
+            size_t k_end = std::max<size_t>(k_begin, std::min<size_t>(width, interior_end - first));
+
+            for (size_t k = 0; k < k_begin; ++k) edge_cell(k);
+            const Sum* next_data = next.data();
+            long long shift = static_cast<long long>(first) - next_first;
+            Sum* current_row = current.data();
+            uint8_t* moves = row_moves.data();
+
+            // Interiors that start the row still use the kernel; the rest take the branch-free loop and pack
+            // their moves afterwards
+            if constexpr (int_down_moves) {
+                if (k_begin == 0) {
+                    row_kernel(row_cells, next_data + shift, current_row, k_end, choices.row_words(r));
+                    k_begin = k_end;
+                }
+            }
+            for (size_t k = k_begin; k < k_end; ++k) {
+                Sum best = next_data[static_cast<long long>(k) + shift + Moves::deltas[0]];
+                uint8_t choice = 0;
+                for (size_t m = 1; m < move_count; ++m) {
+                    Sum candidate = next_data[static_cast<long long>(k) + shift + Moves::deltas[m]];
+                    bool better = candidate < best;
+                    best = better ? candidate : best;
+                    choice = better ? static_cast<uint8_t>(m) : choice;
+                }
+                current_row[k] = row_cells[k] + best;
+                moves[k] = choice;
+            }
+            choices.set_range(r, k_begin, moves + k_begin, k_end - k_begin);
+            for (size_t k = k_end; k < width; ++k) edge_cell(k);
+
+            next.swap(current);
+            observer(r, next.data(), Sum{0});
+        }
+    }
+
+    size_t best_k = std::min_element(next.begin(), next.begin() + layout.width(0)) - next.begin();
+    result.sum = static_cast<int64_t>(next[best_k]) - offset;
+    result.columns.resize(rows);
+
+    size_t col = layout.first(0) + best_k;
+    for (size_t r = 0; r < rows; ++r) {
+        result.columns[r] = col;
+        if (r + 1 < rows) {
+            col += Moves::deltas[choices.get(r, col - layout.first(r))];
+        }
+    }
+    return result;
+}
+
+// Flat input: row r starts at cells + layout.offset(r)
+template <typename Moves, typename Sum = int64_t, typename Layout>
+GridPathResult min_path_dp(const Layout& layout, const int* cells) {
+    return min_path_dp_rows<Moves, Sum>(layout, [&](size_t r) { return cells + layout.offset(r); });
+}
+
+// The reference solver is the move-policy engine instantiated for the triangle (DownMoves over TriangleLayout, rows
+// read in place); this wrapper adds logging, progress reporting and the row-size and int range checks
+std::pair<int, std::vector<int>> minimum_total(const std::vector<std::vector<int>>& triangle, Logger& logger,
+                                               ProgressMonitor* progress = nullptr) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START);
+
+        if (triangle.empty() || triangle[0].empty()) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        int n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        // huge_page_report() reads /proc/self/smaps_rollup, so it only runs when the line is actually logged
+        size_t choice_bytes = (static_cast<size_t>(n - 1) * n / 2 + 63) / 64 * sizeof(uint64_t);
+        if (choice_bytes >= HUGE_PAGE_BYTES && logger.is_enabled()) {
+            logger.info("Choice bits: " + std::to_string(choice_bytes) + " bytes, " + huge_page_report());
+        }
+
+        if (logger.is_enabled() && triangle[n-1].size() == static_cast<size_t>(n)) {
+            logger.info(LogMessages::DP_INITIALIZATION + std::string(format_vector(triangle[n-1].data(), n)));
+        }
+
+        auto start_progress = [&] {
+#if TRIANGLE_PROGRESS
+            if (progress) {
+                progress->begin(n);
+                progress->row_done(n);
+            }
+#else
+            (void)progress;
+#endif
+        };
+
+        // The engine reuses the row below for the new sums, so the trace keeps its own copy of the previous row
+        bool trace_cells = logger.is_enabled();
+        std::vector<int64_t> below;
+        auto on_row = [&](size_t i, const auto* sums, auto offset) {
+#if TRIANGLE_PROGRESS
+            if (progress) progress->row_done(i + 1);
+#endif
+            if (!trace_cells) return;
+            if (i + 2 == triangle.size()) below.assign(triangle[i+1].begin(), triangle[i+1].end());
+            for (size_t j = 0; j <= i; ++j) {
+                std::string debug_msg = LogMessages::DP_UPDATE + 
+                    std::to_string(j) + "] = min(" + 
+                    std::to_string(triangle[i][j]) + " + " + std::to_string(below[j]) + ", " +
+                    std::to_string(triangle[i][j]) + " + " + std::to_string(below[j+1]) + ") = " +
+                    std::to_string(sums[j] - offset);
+                logger.debug(debug_msg);
+            }
+            below.resize(i + 1);
+            std::transform(sums, sums + i + 1, below.begin(), [&](auto sum) { return sum - offset; });
+        };
+
+        // The engine asks for each row once, just before using it
+        auto checked_rows = [&](size_t row) {
+            const std::vector<int>& cells = triangle[row];
+            if (cells.size() != row + 1) {
+                throw std::invalid_argument("Row " + std::to_string(row) + " has " + std::to_string(cells.size()) +
+                                            " values, expected " + std::to_string(row + 1));
+            }
+            return cells.data();
+        };
+
+        // Sums start in int, range-checked by the engine as it goes; values too large for that rerun in int64_t
+        GridPathResult result;
+        try {
+            start_progress();
+            result = min_path_dp_rows<DownMoves, int>(TriangleLayout{triangle.size()}, checked_rows, on_row);
+        } catch (const std::overflow_error& error) {
+            logger.info(std::string(error.what()) + ", solving with int64_t sums");
+            start_progress();
+            result = min_path_dp_rows<DownMoves, int64_t>(TriangleLayout{triangle.size()}, checked_rows, on_row);
+        }
+
+        if (result.sum < std::numeric_limits<int>::min() || result.sum > std::numeric_limits<int>::max()) {
+            throw std::overflow_error("Minimum path sum " + std::to_string(result.sum) + " does not fit in int");
+        }
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path(n);
+        for (int i = 0; i < n; ++i) {
+            path[i] = triangle[i][result.columns[i]];
+        }
+
+        int min_sum = static_cast<int>(result.sum);
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+// Persistent workers: run() executes the job on every worker (the caller is worker 0)
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    std::mutex run_mutex;
+    std::function<void(size_t)> job;
+    size_t generation = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    void worker_loop(size_t worker_index) {
+        size_t seen_generation = 0;
+        while (true) {
+            std::function<void(size_t)> current_job;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen_generation; });
+                if (stopping) return;
+                seen_generation = generation;
+                current_job = job;
+            }
+
+            current_job(worker_index);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) finished.notify_one();
+        }
+    }
+
+public:
+    explicit ThreadPool(size_t thread_count = std::thread::hardware_concurrency()) {
+        thread_count = std::max<size_t>(thread_count, 1);
+        for (size_t i = 1; i < thread_count; ++i) {
+            workers.emplace_back(&ThreadPool::worker_loop, this, i);
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const {
+        return workers.size() + 1;
+    }
+
+    // Concurrent callers take turns; a task must not call run() on the pool executing it
+    void run(const std::function<void(size_t)>& task) {
+        std::lock_guard<std::mutex> run_lock(run_mutex);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job = task;
+            running = workers.size();
+            ++generation;
+        }
+        wake.notify_all();
+
+        task(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&] { return running == 0; });
+    }
+
+    static ThreadPool& shared() {
+        static ThreadPool pool;
+        return pool;
+    }
+};
+
+// Pool for independent tasks of uneven cost: every worker owns a deque, runs its newest task first and
+// steals the oldest task of another worker when its own deque is empty
+class WorkStealingPool {
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex state_mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+    std::atomic<size_t> queued{0};
+    size_t pending = 0;
+    size_t next_queue = 0;
+    bool stopping = false;
+
+    bool try_pop(size_t index, std::function<void()>& task) {
+        {
+            WorkerQueue& own = *queues[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        for (size_t k = 1; k < queues.size(); ++k) {
+            WorkerQueue& victim = *queues[(index + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void worker_loop(size_t index) {
+        while (true) {
+            std::function<void()> task;
+            if (try_pop(index, task)) {
+                task();
+                std::lock_guard<std::mutex> lock(state_mutex);
+                if (--pending == 0) idle.notify_all();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(state_mutex);
+            wake.wait(lock, [&] { return stopping || queued.load() > 0; });
+            if (stopping && queued.load() == 0) return;
+        }
+    }
+
+public:
+    explicit WorkStealingPool(size_t thread_count = std::thread::hardware_concurrency()) {
+        thread_count = std::max<size_t>(thread_count, 1);
+        for (size_t i = 0; i < thread_count; ++i) {
+            queues.push_back(std::make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t size() const {
+        return workers.size();
+    }
+
+    // Tasks are dealt round-robin; the counter is raised before the push so a pop never sees it at zero
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            ++pending;
+            queued.fetch_add(1);
+            WorkerQueue& queue = *queues[next_queue];
+            next_queue = (next_queue + 1) % queues.size();
+            std::lock_guard<std::mutex> queue_lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        wake.notify_one();
+    }
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(state_mutex);
+        idle.wait(lock, [&] { return pending == 0; });
+    }
+};
+
+class SpinBarrier {
+private:
+    std::atomic<size_t> waiting{0};
+    std::atomic<size_t> phase{0};
+    size_t count;
+
+public:
+    explicit SpinBarrier(size_t participants) : count(participants) {}
+
+    void arrive_and_wait() {
+        size_t current_phase = phase.load(std::memory_order_acquire);
+        if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+            waiting.store(0, std::memory_order_relaxed);
+            phase.fetch_add(1, std::memory_order_release);
+            return;
+        }
+
+        for (int spins = 0; phase.load(std::memory_order_acquire) == current_phase; ++spins) {
+            if (spins > 64) std::this_thread::yield();
+        }
+    }
+};
+
+class PackedChoiceBits {
+private:
+    LargeBuffer<uint64_t> words;
+    size_t rows;
+
+public:
+    static constexpr size_t WORD_BITS = 64;
+
+    explicit PackedChoiceBits(size_t row_count = 0)
+        : words(row_word_offset(row_count)), rows(row_count) {}
+
+    // Rows start on a word boundary so a whole word of choices can be stored at once
+    static size_t row_word_offset(size_t row) {
+        size_t q = row / WORD_BITS;
+        size_t r = row % WORD_BITS;
+        return WORD_BITS * q * (q + 1) / 2 + r * (q + 1);
+    }
+
+    uint64_t* row_words(size_t row) {
+        return words.data() + row_word_offset(row);
+    }
+
+    const uint64_t* row_words(size_t row) const {
+        return words.data() + row_word_offset(row);
+    }
+
+    void set(size_t row, size_t col, bool right) {
+        uint64_t mask = uint64_t{1} << (col % WORD_BITS);
+        uint64_t& word = row_words(row)[col / WORD_BITS];
+        word = right ? (word | mask) : (word & ~mask);
+    }
+
+    bool get(size_t row, size_t col) const {
+        return (row_words(row)[col / WORD_BITS] >> (col % WORD_BITS)) & 1u;
+    }
+
+    // Copies count bits from src (starting at bit 0) into row at column begin, leaving other bits intact
+    void assign_range(size_t row, size_t begin, const uint64_t* src, size_t count) {
+        uint64_t* dst = row_words(row);
+        for (size_t done = 0; done < count; ) {
+            size_t col = begin + done;
+            size_t offset = col % WORD_BITS;
+            size_t take = std::min(WORD_BITS - offset, count - done);
+
+            size_t src_offset = done % WORD_BITS;
+            uint64_t chunk = src[done / WORD_BITS] >> src_offset;
+            if (src_offset != 0 && src_offset + take > WORD_BITS) {
+                chunk |= src[done / WORD_BITS + 1] << (WORD_BITS - src_offset);
+            }
+
+            uint64_t mask = (take == WORD_BITS ? ~uint64_t{0} : ((uint64_t{1} << take) - 1)) << offset;
+            dst[col / WORD_BITS] = (dst[col / WORD_BITS] & ~mask) | ((chunk << offset) & mask);
+            done += take;
+        }
+    }
+
+    void append_row() {
+        ++rows;
+        words.resize(row_word_offset(rows));
+    }
+
+    size_t row_count() const {
+        return rows;
+    }
+
+    size_t memory_bytes() const {
+        return words.size() * sizeof(uint64_t);
+    }
+};
+
+// Row kernels: out[j] = row[j] + min(below[j], below[j+1]) for j < width.
+// below must hold width + 1 values; out may alias below for an in-place update.
+// If bits is not null, bit j is set when the right child was taken.
+// If seen is not null, every sum written is OR-ed into it. Sums wrap on overflow in every lane, so a caller that
+// keeps its sums in a known range can tell from the high bits of seen whether any left it.
+// If minimum is not null, it keeps the smallest sum written and its leftmost column, so a caller needing the row's
+// minimum does not scan the row again.
+void row_kernel_scalar(const int* row, const int* below, int* out, size_t width, uint64_t* bits,
+                       SumBits* seen = nullptr, RowMinimum* minimum = nullptr) {
+    uint64_t word = 0;
+    uint32_t sum_bits = 0;
+    for (size_t j = 0; j < width; ++j) {
+        bool right = below[j+1] < below[j];
+        out[j] = wrapping_add(row[j], right ? below[j+1] : below[j]);
+        sum_bits |= static_cast<uint32_t>(out[j]);
+        if (minimum) minimum->add(out[j], j);
+        word |= static_cast<uint64_t>(right) << (j % PackedChoiceBits::WORD_BITS);
+
+        if (j % PackedChoiceBits::WORD_BITS == PackedChoiceBits::WORD_BITS - 1 || j + 1 == width) {
+            if (bits) bits[j / PackedChoiceBits::WORD_BITS] = word;
+            word = 0;
+        }
+    }
+    if (seen) seen->lanes[0] |= sum_bits;
+}
+
+#if defined(TRIANGLE_X86_DISPATCH)
+__attribute__((target("sse4.2")))
+void row_kernel_sse42(const int* row, const int* below, int* out, size_t width, uint64_t* bits, SumBits* seen,
+                      RowMinimum* minimum) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+    __m128i sum_bits = seen ? _mm_load_si128(reinterpret_cast<const __m128i*>(seen->lanes.data())) : _mm_setzero_si128();
+    __m128i min_values = _mm_set1_epi32(std::numeric_limits<int>::max());
+    __m128i min_columns = _mm_setzero_si128();
+    __m128i columns = _mm_setr_epi32(0, 1, 2, 3);
+
+    size_t j = 0;
+    for (; j + 4 <= width; j += 4) {
+        __m128i down = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j));
+        __m128i down_right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j + 1));
+        __m128i cell = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + j));
+
+        __m128i sum = _mm_add_epi32(cell, _mm_min_epi32(down, down_right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), sum);
+
+        if (bits) {
+            __m128i right = _mm_cmpgt_epi32(down, down_right);
+            uint64_t mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(right)));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+        if (seen) sum_bits = _mm_or_si128(sum_bits, sum);
+        if (minimum) {
+            __m128i lower = _mm_cmpgt_epi32(min_values, sum);
+            min_values = _mm_blendv_epi8(min_values, sum, lower);
+            min_columns = _mm_blendv_epi8(min_columns, columns, lower);
+            columns = _mm_add_epi32(columns, _mm_set1_epi32(4));
+        }
+    }
+
+    if (seen) _mm_store_si128(reinterpret_cast<__m128i*>(seen->lanes.data()), sum_bits);
+    if (minimum) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(minimum->values.data()), min_values);
+        _mm_store_si128(reinterpret_cast<__m128i*>(minimum->columns.data()), min_columns);
+    }
+    for (; j < width; ++j) {
+        bool right = below[j+1] < below[j];
+        out[j] = wrapping_add(row[j], right ? below[j+1] : below[j]);
+        if (bits && right) bits[j / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (j % PackedChoiceBits::WORD_BITS);
+        if (seen) seen->add(out[j]);
+        if (minimum) minimum->add(out[j], j);
+    }
+}
+
+__attribute__((target("avx2")))
+void row_kernel_avx2(const int* row, const int* below, int* out, size_t width, uint64_t* bits, SumBits* seen,
+                     RowMinimum* minimum) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+    __m256i sum_bits = seen ? _mm256_load_si256(reinterpret_cast<const __m256i*>(seen->lanes.data()))
+                            : _mm256_setzero_si256();
+    __m256i min_values = _mm256_set1_epi32(std::numeric_limits<int>::max());
+    __m256i min_columns = _mm256_setzero_si256();
+    __m256i columns = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+    size_t j = 0;
+    for (; j + 8 <= width; j += 8) {
+        __m256i down = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j));
+        __m256i down_right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j + 1));
+        __m256i cell = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + j));
+
+        __m256i sum = _mm256_add_epi32(cell, _mm256_min_epi32(down, down_right));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), sum);
+
+        if (bits) {
+            __m256i right = _mm256_cmpgt_epi32(down, down_right);
+            uint64_t mask = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(right)));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+        if (seen) sum_bits = _mm256_or_si256(sum_bits, sum);
+        if (minimum) {
+            __m256i lower = _mm256_cmpgt_epi32(min_values, sum);
+            min_values = _mm256_blendv_epi8(min_values, sum, lower);
+            min_columns = _mm256_blendv_epi8(min_columns, columns, lower);
+            columns = _mm256_add_epi32(columns, _mm256_set1_epi32(8));
+        }
+    }
+
+    if (seen) _mm256_store_si256(reinterpret_cast<__m256i*>(seen->lanes.data()), sum_bits);
+    if (minimum) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(minimum->values.data()), min_values);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(minimum->columns.data()), min_columns);
+    }
+    for (; j < width; ++j) {
+        bool right = below[j+1] < below[j];
+        out[j] = wrapping_add(row[j], right ? below[j+1] : below[j]);
+        if (bits && right) bits[j / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (j % PackedChoiceBits::WORD_BITS);
+        if (seen) seen->add(out[j]);
+        if (minimum) minimum->add(out[j], j);
+    }
+}
+
+// GCC 12 implements _mm512_min_epi32 as a merge with an uninitialised source, which trips -Wmaybe-uninitialized;
+// the explicit merge form compiles to the same vpminsd
+__attribute__((target("avx512f")))
+inline __m512i min_epi32_avx512(__m512i a, __m512i b) {
+    return _mm512_mask_min_epi32(a, 0xFFFF, a, b);
+}
+
+__attribute__((target("avx512f")))
+void row_kernel_avx512(const int* row, const int* below, int* out, size_t width, uint64_t* bits, SumBits* seen,
+                       RowMinimum* minimum) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+    __m512i sum_bits = seen ? _mm512_load_si512(seen->lanes.data()) : _mm512_setzero_si512();
+    __m512i min_values = _mm512_set1_epi32(std::numeric_limits<int>::max());
+    __m512i min_columns = _mm512_setzero_si512();
+    __m512i columns = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+    // The tail runs through the same body with masked, zero-filled loads instead of a scalar loop
+    for (size_t j = 0; j < width; j += 16) {
+        __mmask16 lanes = width - j >= 16 ? __mmask16(0xFFFF) : __mmask16((1u << (width - j)) - 1);
+        __m512i down = _mm512_maskz_loadu_epi32(lanes, below + j);
+        __m512i down_right = _mm512_maskz_loadu_epi32(lanes, below + j + 1);
+        __m512i cell = _mm512_maskz_loadu_epi32(lanes, row + j);
+
+        __m512i sum = _mm512_add_epi32(cell, min_epi32_avx512(down, down_right));
+        _mm512_mask_storeu_epi32(out + j, lanes, sum);
+
+        if (bits) {
+            uint64_t mask = _mm512_mask_cmpgt_epi32_mask(lanes, down, down_right);
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+        if (seen) sum_bits = _mm512_mask_or_epi32(sum_bits, lanes, sum_bits, sum);
+        if (minimum) {
+            __mmask16 lower = _mm512_mask_cmplt_epi32_mask(lanes, sum, min_values);
+            min_values = _mm512_mask_mov_epi32(min_values, lower, sum);
+            min_columns = _mm512_mask_mov_epi32(min_columns, lower, columns);
+            columns = _mm512_add_epi32(columns, _mm512_set1_epi32(16));
+        }
+    }
+
+    if (seen) _mm512_store_si512(seen->lanes.data(), sum_bits);
+    if (minimum) {
+        _mm512_store_si512(minimum->values.data(), min_values);
+        _mm512_store_si512(minimum->columns.data(), min_columns);
+    }
+}
+#endif
+
+enum class CpuLevel { Scalar, SSE42, AVX2, AVX512 };
+
+const char* cpu_level_name(CpuLevel level) {
+    switch (level) {
+        case CpuLevel::SSE42: return "sse4.2";
+        case CpuLevel::AVX2: return "avx2";
+        case CpuLevel::AVX512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+bool parse_cpu_level(const std::string& name, CpuLevel& level) {
+    for (CpuLevel candidate : {CpuLevel::Scalar, CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512}) {
+        if (name == cpu_level_name(candidate)) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// CPUID feature bits plus an XGETBV check that the OS saves the wider registers; AVX512 means F and BW
+CpuLevel detect_cpu_level() {
+#if defined(TRIANGLE_X86_DISPATCH)
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return CpuLevel::Scalar;
+
+    bool sse42 = ecx & (1u << 20);
+    bool osxsave = ecx & (1u << 27);
+    bool avx = ecx & (1u << 28);
+    if (!sse42) return CpuLevel::Scalar;
+    if (!osxsave || !avx) return CpuLevel::SSE42;
+
+    unsigned xcr0_low, xcr0_high;
+    __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+    bool ymm_state = (xcr0_low & 0x6) == 0x6;
+    bool zmm_state = (xcr0_low & 0xe6) == 0xe6;
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !ymm_state) return CpuLevel::SSE42;
+    bool avx2 = ebx & (1u << 5);
+    bool avx512 = (ebx & (1u << 16)) && (ebx & (1u << 30));
+
+    if (avx512 && zmm_state) return CpuLevel::AVX512;
+    if (avx2) return CpuLevel::AVX2;
+    return CpuLevel::SSE42;
+#else
+    return CpuLevel::Scalar;
+#endif
+}
+
+// ENV=scalar|sse4.2|avx2|avx512 lowers the detected level, e.g. to test the fallbacks
+CpuLevel select_cpu_level(const char* variable) {
+    CpuLevel detected = detect_cpu_level();
+    const char* forced = std::getenv(variable);
+    CpuLevel level;
+    if (forced && parse_cpu_level(forced, level)) {
+        return std::min(level, detected);
+    }
+    return detected;
+}
+
+using RowKernelFunction = void (*)(const int*, const int*, int*, size_t, uint64_t*, SumBits*, RowMinimum*);
+
+RowKernelFunction row_kernel_for(CpuLevel level) {
+#if defined(TRIANGLE_X86_DISPATCH)
+    switch (level) {
+        case CpuLevel::AVX512: return row_kernel_avx512;
+        case CpuLevel::AVX2: return row_kernel_avx2;
+        case CpuLevel::SSE42: return row_kernel_sse42;
+        default: break;
+    }
+#else
+    (void)level;
+#endif
+    return row_kernel_scalar;
+}
+
+// Bound once at startup
+const CpuLevel active_cpu_level = select_cpu_level("TRIANGLE_CPU_LEVEL");
+const RowKernelFunction active_row_kernel = row_kernel_for(active_cpu_level);
+
+inline void row_kernel(const int* row, const int* below, int* out, size_t width, uint64_t* bits,
+                       SumBits* seen, RowMinimum* minimum) {
+    active_row_kernel(row, below, out, width, bits, seen, minimum);
+}
+
+std::string row_kernel_name() {
+    return cpu_level_name(active_cpu_level);
+}
+
+// Triangle stored row after row in one buffer; row i starts at i * (i + 1) / 2
+template <typename Cell>
+struct BasicTriangleView {
+    const Cell* cells = nullptr;
+    size_t rows = 0;
+
+    static size_t row_offset(size_t row) {
+        return row * (row + 1) / 2;
+    }
+
+    static size_t cell_count(size_t row_count) {
+        return row_offset(row_count);
+    }
+
+    const Cell* operator[](size_t row) const {
+        return cells + row_offset(row);
+    }
+
+    size_t size() const {
+        return rows;
+    }
+
+    bool empty() const {
+        return rows == 0;
+    }
+};
+
+using TriangleView = BasicTriangleView<int>;
+
+template <typename Cell>
+inline const Cell* row_pointer(const std::vector<std::vector<Cell>>& triangle, size_t row) {
+    return triangle[row].data();
+}
+
+template <typename Cell>
+inline const Cell* row_pointer(const BasicTriangleView<Cell>& triangle, size_t row) {
+    return triangle[row];
+}
+
+template <typename Cell>
+inline bool triangle_is_empty(const std::vector<std::vector<Cell>>& triangle) {
+    return triangle.empty() || triangle[0].empty();
+}
+
+template <typename Cell>
+inline bool triangle_is_empty(const BasicTriangleView<Cell>& triangle) {
+    return triangle.empty();
+}
+
+template <typename Triangle>
+auto reconstruct_path_from_choices(const Triangle& triangle, const PackedChoiceBits& choices) {
+    std::vector<std::decay_t<decltype(triangle[0][0])>> path;
+    path.reserve(triangle.size());
+    size_t current_col = 0;
+    path.push_back(triangle[0][current_col]);
+
+    for (size_t i = 1; i < triangle.size(); ++i) {
+        if (choices.get(i - 1, current_col)) {
+            current_col += 1;
+        }
+        path.push_back(triangle[i][current_col]);
+    }
+    return path;
+}
+
+struct PathStep {
+    size_t row;
+    size_t column;
+};
+
+// Solver result with the path stored as one direction bit per row step (bit r set = went right from row r to
+// row r + 1): about 12 KB for 10^5 rows instead of one int per row. Columns and cell values are derived on demand
+class CompactPath {
+private:
+    size_t rows = 0;
+    int64_t total = 0;
+    std::vector<uint64_t> directions;
+
+    struct SerializedHeader {
+        char magic[8];
+        uint64_t rows;
+        int64_t sum;
+    };
+
+public:
+    static constexpr char MAGIC[8] = {'T', 'R', 'I', 'P', 'A', 'T', 'H', '\1'};
+
+    CompactPath() = default;
+
+    // direction_words holds at least ceil((row_count - 1) / 64) words in the layout above
+    CompactPath(size_t row_count, int64_t sum, std::vector<uint64_t> direction_words)
+        : rows(row_count), total(sum), directions(std::move(direction_words)) {
+        directions.resize(word_count(rows));
+    }
+
+    static size_t word_count(size_t row_count) {
+        return row_count > 1 ? (row_count - 2) / PackedChoiceBits::WORD_BITS + 1 : 0;
+    }
+
+    static CompactPath from_choices(const PackedChoiceBits& choices, size_t row_count, int64_t sum) {
+        std::vector<uint64_t> words(word_count(row_count), 0);
+        size_t col = 0;
+        for (size_t i = 0; i + 1 < row_count; ++i) {
+            if (choices.get(i, col)) {
+                words[i / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (i % PackedChoiceBits::WORD_BITS);
+                col += 1;
+            }
+        }
+        return CompactPath(row_count, sum, std::move(words));
+    }
+
+    static CompactPath from_columns(const std::vector<size_t>& columns, int64_t sum) {
+        std::vector<uint64_t> words(word_count(columns.size()), 0);
+        for (size_t i = 0; i + 1 < columns.size(); ++i) {
+            if (columns[i + 1] == columns[i] + 1) {
+                words[i / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (i % PackedChoiceBits::WORD_BITS);
+            } else if (columns[i + 1] != columns[i]) {
+                throw std::invalid_argument("Columns do not form a triangle path at row " + std::to_string(i + 1));
+            }
+        }
+        return CompactPath(columns.size(), sum, std::move(words));
+    }
+
+    size_t size() const {
+        return rows;
+    }
+
+    bool empty() const {
+        return rows == 0;
+    }
+
+    int64_t sum() const {
+        return total;
+    }
+
+    bool went_right(size_t row) const {
+        return (directions[row / PackedChoiceBits::WORD_BITS] >> (row % PackedChoiceBits::WORD_BITS)) & 1u;
+    }
+
+    // Number of right steps above the row, counted a word at a time
+    size_t column(size_t row) const {
+        size_t full_words = row / PackedChoiceBits::WORD_BITS;
+        size_t col = 0;
+        for (size_t w = 0; w < full_words; ++w) {
+            col += __builtin_popcountll(directions[w]);
+        }
+        size_t rest = row % PackedChoiceBits::WORD_BITS;
+        if (rest > 0) {
+            col += __builtin_popcountll(directions[full_words] & ((uint64_t{1} << rest) - 1));
+        }
+        return col;
+    }
+
+    template <typename Triangle>
+    auto value(const Triangle& triangle, size_t row) const {
+        return row_pointer(triangle, row)[column(row)];
+    }
+
+    template <typename Triangle>
+    auto values(const Triangle& triangle) const {
+        std::vector<std::decay_t<decltype(row_pointer(triangle, 0)[0])>> path;
+        path.reserve(rows);
+        for (PathStep step : *this) {
+            path.push_back(row_pointer(triangle, step.row)[step.column]);
+        }
+        return path;
+    }
+
+    std::vector<size_t> columns() const {
+        std::vector<size_t> result;
+        result.reserve(rows);
+        for (PathStep step : *this) {
+            result.push_back(step.column);
+        }
+        return result;
+    }
+
+    // Walks the path top-down in O(1) per step
+    class const_iterator {
+    private:
+        const CompactPath* path = nullptr;
+        PathStep step{0, 0};
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = PathStep;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const PathStep*;
+        using reference = const PathStep&;
+
+        const_iterator() = default;
+        const_iterator(const CompactPath* owner, size_t row) : path(owner), step{row, 0} {}
+
+        reference operator*() const {
+            return step;
+        }
+
+        pointer operator->() const {
+            return &step;
+        }
+
+        const_iterator& operator++() {
+            if (step.row + 1 < path->rows && path->went_right(step.row)) {
+                step.column += 1;
+            }
+            step.row += 1;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return step.row == other.step.row;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const {
+        return const_iterator(this, rows);
+    }
+
+    size_t memory_bytes() const {
+        return directions.size() * sizeof(uint64_t);
+    }
+
+    // 24-byte header (magic, rows, sum) followed by the direction words
+    std::string serialize() const {
+        SerializedHeader header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.rows = rows;
+        header.sum = total;
+
+        std::string bytes(sizeof(header) + memory_bytes(), '\0');
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        if (!directions.empty()) {
+            std::memcpy(bytes.data() + sizeof(header), directions.data(), memory_bytes());
+        }
+        return bytes;
+    }
+
+    static CompactPath deserialize(std::string_view bytes) {
+        SerializedHeader header;
+        if (bytes.size() < sizeof(header)) {
+            throw std::runtime_error("Serialized path is shorter than its header");
+        }
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw std::runtime_error("Not a serialized triangle path");
+        }
+
+        std::vector<uint64_t> words(word_count(header.rows));
+        if (bytes.size() != sizeof(header) + words.size() * sizeof(uint64_t)) {
+            throw std::runtime_error("Serialized path size does not match its row count");
+        }
+        if (!words.empty()) {
+            std::memcpy(words.data(), bytes.data() + sizeof(header), words.size() * sizeof(uint64_t));
+        }
+        return CompactPath(header.rows, header.sum, std::move(words));
+    }
+
+    bool operator==(const CompactPath& other) const {
+        return rows == other.rows && total == other.total && directions == other.directions;
+    }
+
+    bool operator!=(const CompactPath& other) const {
+        return !(*this == other);
+    }
+};
+
+// Bottom-up sweep shared by the compact solvers; returns the minimum sum
+template <typename Triangle>
+int fill_choice_bits(const Triangle& triangle, PackedChoiceBits& choices) {
+    size_t n = triangle.size();
+    std::vector<int> row_sums(row_pointer(triangle, n-1), row_pointer(triangle, n-1) + n);
+    for (size_t i = n - 1; i-- > 0; ) {
+        row_kernel(row_pointer(triangle, i), row_sums.data(), row_sums.data(), i + 1, choices.row_words(i));
+    }
+    return row_sums[0];
+}
+
+// One rolling row of sums plus one bit per cell ("went right") instead of the full dp table
+template <typename Triangle>
+std::pair<int, std::vector<int>> minimum_total_compact(const Triangle& triangle, Logger& logger) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (compact mode)");
+
+        if (triangle_is_empty(triangle)) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        int n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        PackedChoiceBits choices(n - 1);
+
+        logger.info("Row kernel: " + row_kernel_name());
+        int min_sum = fill_choice_bits(triangle, choices);
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path = reconstruct_path_from_choices(triangle, choices);
+
+        logger.info("Choice bitmap size: " + std::to_string(choices.memory_bytes()) + " bytes");
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in compact minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+// Compact solver returning the packed path instead of the cell values
+template <typename Triangle>
+CompactPath minimum_total_compact_path(const Triangle& triangle, Logger& logger) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (compact path mode)");
+
+        if (triangle_is_empty(triangle)) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return CompactPath();
+        }
+
+        size_t n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        PackedChoiceBits choices(n - 1);
+        int min_sum = fill_choice_bits(triangle, choices);
+        CompactPath path = CompactPath::from_choices(choices, n, min_sum);
+
+        logger.info("Packed path size: " + std::to_string(path.memory_bytes()) + " bytes");
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        return path;
+
+    } catch (const std::exception& error) {
+        logger.error("Error in compact path calculation: " + std::string(error.what()));
+        return CompactPath(0, std::numeric_limits<int>::max(), {});
+    }
+}
+
+// Cell types the typed solver is instantiated for, with the accumulator used by default
+template <typename Cell> struct ValueTypeTraits;
+template <> struct ValueTypeTraits<int8_t> { using Sum = int32_t; static constexpr const char* name = "int8"; };
+template <> struct ValueTypeTraits<int16_t> { using Sum = int32_t; static constexpr const char* name = "int16"; };
+template <> struct ValueTypeTraits<int32_t> { using Sum = int64_t; static constexpr const char* name = "int32"; };
+template <> struct ValueTypeTraits<int64_t> { using Sum = int64_t; static constexpr const char* name = "int64"; };
+template <> struct ValueTypeTraits<float> { using Sum = double; static constexpr const char* name = "float"; };
+template <> struct ValueTypeTraits<double> { using Sum = double; static constexpr const char* name = "double"; };
+
+// Sums of the auto solver's narrow passes are stored plus a quarter of their type's range, as the engine's int
+// kernel rows are: every sum within +-OFFSET lies in [0, 2 * OFFSET), and any other value a row can produce from
+// such sums, cells saturated to the type included, has one of the top two bits set. int64 sums of int cells
+// never leave their range
+template <typename Sum>
+struct OffsetSums {
+    static constexpr Sum OFFSET = Sum(1) << (8 * sizeof(Sum) - 3);
+
+    static bool outside(Sum stored) {
+        return static_cast<std::make_unsigned_t<Sum>>(stored) >> (8 * sizeof(Sum) - 2);
+    }
+};
+
+template <>
+struct OffsetSums<int64_t> {
+    static constexpr int64_t OFFSET = 0;
+
+    static bool outside(int64_t) {
+        return false;
+    }
+};
+
+// Cell narrowed the way the SIMD packs narrow it: values outside Sum saturate
+template <typename Sum, typename Cell>
+Sum saturate_cast(Cell value) {
+    if constexpr (sizeof(Cell) <= sizeof(Sum)) {
+        return static_cast<Sum>(value);
+    } else {
+        return static_cast<Sum>(std::clamp<Cell>(value, std::numeric_limits<Sum>::min(), std::numeric_limits<Sum>::max()));
+    }
+}
+
+// Narrow-lane kernels: row_kernel's contract on int8_t or int16_t sums, so a vector holds four or two times as
+// many cells as the int kernels. Cells are either of the sum type (the typed solver) or int, narrowed in registers
+// with saturation (the auto solver); left_range, when given, is set if a sum has either of the top two bits set.
+// Lanes wrap. The tail (or, from j = 0 on zeroed bits, the whole row) runs through the scalar loop
+template <typename Cell, typename Sum>
+void row_kernel_narrow_tail(const Cell* row, const Sum* below, Sum* out, size_t j, size_t width, uint64_t* bits,
+                            bool* left_range) {
+    bool outside = false;
+    for (; j < width; ++j) {
+        bool right = below[j+1] < below[j];
+        out[j] = static_cast<Sum>(saturate_cast<Sum>(row[j]) + (right ? below[j+1] : below[j]));
+        outside |= OffsetSums<Sum>::outside(out[j]);
+        if (bits) bits[j / PackedChoiceBits::WORD_BITS] |= uint64_t{right} << (j % PackedChoiceBits::WORD_BITS);
+    }
+    if (left_range && outside) *left_range = true;
+}
+
+#if defined(TRIANGLE_X86_DISPATCH)
+// Cell loaders: a vector of cells of the sum type, or the same number of int values packed down to it
+__attribute__((target("sse4.2")))
+inline __m128i load_int8_cells_sse42(const int8_t* row) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+}
+
+__attribute__((target("sse4.2")))
+inline __m128i load_int8_cells_sse42(const int* row) {
+    const __m128i* values = reinterpret_cast<const __m128i*>(row);
+    __m128i low = _mm_packs_epi32(_mm_loadu_si128(values), _mm_loadu_si128(values + 1));
+    __m128i high = _mm_packs_epi32(_mm_loadu_si128(values + 2), _mm_loadu_si128(values + 3));
+    return _mm_packs_epi16(low, high);
+}
+
+__attribute__((target("sse4.2")))
+inline __m128i load_int16_cells_sse42(const int16_t* row) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(row));
+}
+
+__attribute__((target("sse4.2")))
+inline __m128i load_int16_cells_sse42(const int* row) {
+    const __m128i* values = reinterpret_cast<const __m128i*>(row);
+    return _mm_packs_epi32(_mm_loadu_si128(values), _mm_loadu_si128(values + 1));
+}
+
+// The 256- and 512-bit packs work within 128-bit lanes; the permutes put the packed values back in row order.
+// The AVX-512 ones use the zero-masking forms for the reason given at min_epi32_avx512
+__attribute__((target("avx2")))
+inline __m256i load_int8_cells_avx2(const int8_t* row) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+}
+
+__attribute__((target("avx2")))
+inline __m256i load_int8_cells_avx2(const int* row) {
+    const __m256i* values = reinterpret_cast<const __m256i*>(row);
+    __m256i low = _mm256_packs_epi32(_mm256_loadu_si256(values), _mm256_loadu_si256(values + 1));
+    __m256i high = _mm256_packs_epi32(_mm256_loadu_si256(values + 2), _mm256_loadu_si256(values + 3));
+    return _mm256_permutevar8x32_epi32(_mm256_packs_epi16(low, high), _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+}
+
+__attribute__((target("avx2")))
+inline __m256i load_int16_cells_avx2(const int16_t* row) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row));
+}
+
+__attribute__((target("avx2")))
+inline __m256i load_int16_cells_avx2(const int* row) {
+    const __m256i* values = reinterpret_cast<const __m256i*>(row);
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(_mm256_loadu_si256(values), _mm256_loadu_si256(values + 1)), 0xD8);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i load_int8_cells_avx512(const int8_t* row, __mmask64 lanes) {
+    return _mm512_maskz_loadu_epi8(lanes, row);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i load_int8_cells_avx512(const int* row, __mmask64 lanes) {
+    __m512i low = _mm512_packs_epi32(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes), row),
+                                     _mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes >> 16), row + 16));
+    __m512i high = _mm512_packs_epi32(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes >> 32), row + 32),
+                                      _mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes >> 48), row + 48));
+    __m512i order = _mm512_setr_epi32(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    return _mm512_maskz_permutexvar_epi32(0xFFFF, order, _mm512_packs_epi16(low, high));
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i load_int16_cells_avx512(const int16_t* row, __mmask32 lanes) {
+    return _mm512_maskz_loadu_epi16(lanes, row);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+inline __m512i load_int16_cells_avx512(const int* row, __mmask32 lanes) {
+    __m512i words = _mm512_packs_epi32(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes), row),
+                                       _mm512_maskz_loadu_epi32(static_cast<__mmask16>(lanes >> 16), row + 16));
+    return _mm512_maskz_permutexvar_epi64(0xFF, _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), words);
+}
+
+template <typename Cell>
+__attribute__((target("sse4.2")))
+void row_kernel_int8_sse42(const Cell* row, const int8_t* below, int8_t* out, size_t width, uint64_t* bits,
+                           bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m128i sum_bits = _mm_setzero_si128();
+    size_t j = 0;
+    for (; j + 16 <= width; j += 16) {
+        __m128i down = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j));
+        __m128i down_right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j + 1));
+        __m128i sum = _mm_add_epi8(load_int8_cells_sse42(row + j), _mm_min_epi8(down, down_right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), sum);
+        sum_bits = _mm_or_si128(sum_bits, sum);
+
+        if (bits) {
+            uint64_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(down, down_right)));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+    }
+    if (left_range && !_mm_testz_si128(sum_bits, _mm_set1_epi8(static_cast<char>(0xC0)))) *left_range = true;
+    row_kernel_narrow_tail(row, below, out, j, width, bits, left_range);
+}
+
+// Comparisons give 16-bit lanes of 0 or -1; packing them to bytes lets movemask take one bit per cell
+template <typename Cell>
+__attribute__((target("sse4.2")))
+void row_kernel_int16_sse42(const Cell* row, const int16_t* below, int16_t* out, size_t width, uint64_t* bits,
+                            bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m128i sum_bits = _mm_setzero_si128();
+    size_t j = 0;
+    for (; j + 8 <= width; j += 8) {
+        __m128i down = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j));
+        __m128i down_right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(below + j + 1));
+        __m128i sum = _mm_add_epi16(load_int16_cells_sse42(row + j), _mm_min_epi16(down, down_right));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), sum);
+        sum_bits = _mm_or_si128(sum_bits, sum);
+
+        if (bits) {
+            __m128i right = _mm_packs_epi16(_mm_cmpgt_epi16(down, down_right), _mm_setzero_si128());
+            uint64_t mask = static_cast<uint32_t>(_mm_movemask_epi8(right));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+    }
+    if (left_range && !_mm_testz_si128(sum_bits, _mm_set1_epi16(static_cast<short>(0xC000)))) *left_range = true;
+    row_kernel_narrow_tail(row, below, out, j, width, bits, left_range);
+}
+
+template <typename Cell>
+__attribute__((target("avx2")))
+void row_kernel_int8_avx2(const Cell* row, const int8_t* below, int8_t* out, size_t width, uint64_t* bits,
+                          bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m256i sum_bits = _mm256_setzero_si256();
+    size_t j = 0;
+    for (; j + 32 <= width; j += 32) {
+        __m256i down = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j));
+        __m256i down_right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j + 1));
+        __m256i sum = _mm256_add_epi8(load_int8_cells_avx2(row + j), _mm256_min_epi8(down, down_right));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), sum);
+        sum_bits = _mm256_or_si256(sum_bits, sum);
+
+        if (bits) {
+            uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(down, down_right)));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+    }
+    if (left_range && !_mm256_testz_si256(sum_bits, _mm256_set1_epi8(static_cast<char>(0xC0)))) *left_range = true;
+    row_kernel_narrow_tail(row, below, out, j, width, bits, left_range);
+}
+
+template <typename Cell>
+__attribute__((target("avx2")))
+void row_kernel_int16_avx2(const Cell* row, const int16_t* below, int16_t* out, size_t width, uint64_t* bits,
+                           bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m256i sum_bits = _mm256_setzero_si256();
+    size_t j = 0;
+    for (; j + 16 <= width; j += 16) {
+        __m256i down = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j));
+        __m256i down_right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + j + 1));
+        __m256i sum = _mm256_add_epi16(load_int16_cells_avx2(row + j), _mm256_min_epi16(down, down_right));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), sum);
+        sum_bits = _mm256_or_si256(sum_bits, sum);
+
+        if (bits) {
+            __m256i right = _mm256_packs_epi16(_mm256_cmpgt_epi16(down, down_right), _mm256_setzero_si256());
+            uint64_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(right, 0xD8)));
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+    }
+    if (left_range && !_mm256_testz_si256(sum_bits, _mm256_set1_epi16(static_cast<short>(0xC000)))) *left_range = true;
+    row_kernel_narrow_tail(row, below, out, j, width, bits, left_range);
+}
+
+// As in row_kernel_avx512, the tail runs through the same body with masked loads and stores; its zeroed lanes
+// sum to 0 and leave sum_bits alone
+template <typename Cell>
+__attribute__((target("avx512f,avx512bw")))
+void row_kernel_int8_avx512(const Cell* row, const int8_t* below, int8_t* out, size_t width, uint64_t* bits,
+                            bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m512i sum_bits = _mm512_setzero_si512();
+    for (size_t j = 0; j < width; j += 64) {
+        __mmask64 lanes = width - j >= 64 ? ~__mmask64(0) : (__mmask64(1) << (width - j)) - 1;
+        __m512i down = _mm512_maskz_loadu_epi8(lanes, below + j);
+        __m512i down_right = _mm512_maskz_loadu_epi8(lanes, below + j + 1);
+        __m512i sum = _mm512_add_epi8(load_int8_cells_avx512(row + j, lanes), _mm512_min_epi8(down, down_right));
+        _mm512_mask_storeu_epi8(out + j, lanes, sum);
+        sum_bits = _mm512_or_si512(sum_bits, sum);
+
+        if (bits) bits[j / PackedChoiceBits::WORD_BITS] = _mm512_mask_cmpgt_epi8_mask(lanes, down, down_right);
+    }
+    if (left_range && _mm512_test_epi8_mask(sum_bits, _mm512_set1_epi8(static_cast<char>(0xC0)))) *left_range = true;
+}
+
+template <typename Cell>
+__attribute__((target("avx512f,avx512bw")))
+void row_kernel_int16_avx512(const Cell* row, const int16_t* below, int16_t* out, size_t width, uint64_t* bits,
+                             bool* left_range) {
+    if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+
+    __m512i sum_bits = _mm512_setzero_si512();
+    for (size_t j = 0; j < width; j += 32) {
+        __mmask32 lanes = width - j >= 32 ? ~__mmask32(0) : (__mmask32(1) << (width - j)) - 1;
+        __m512i down = _mm512_maskz_loadu_epi16(lanes, below + j);
+        __m512i down_right = _mm512_maskz_loadu_epi16(lanes, below + j + 1);
+        __m512i sum = _mm512_add_epi16(load_int16_cells_avx512(row + j, lanes), _mm512_min_epi16(down, down_right));
+        _mm512_mask_storeu_epi16(out + j, lanes, sum);
+        sum_bits = _mm512_or_si512(sum_bits, sum);
+
+        if (bits) {
+            uint64_t mask = _mm512_mask_cmpgt_epi16_mask(lanes, down, down_right);
+            bits[j / PackedChoiceBits::WORD_BITS] |= mask << (j % PackedChoiceBits::WORD_BITS);
+        }
+    }
+    if (left_range && _mm512_test_epi16_mask(sum_bits, _mm512_set1_epi16(static_cast<short>(0xC000)))) *left_range = true;
+}
+#endif
+
+// left_range as in the narrow-lane kernels; wider sums are never flagged
+template <typename Cell, typename Sum>
+void row_kernel_typed(const Cell* row, const Sum* below, Sum* out, size_t width, uint64_t* bits,
+                      bool* left_range = nullptr) {
+    if constexpr (std::is_same_v<Cell, int> && std::is_same_v<Sum, int>) {
+        row_kernel(row, below, out, width, bits);
+        return;
+    } else if constexpr (std::is_same_v<Sum, int8_t> || std::is_same_v<Sum, int16_t>) {
+#if defined(TRIANGLE_X86_DISPATCH)
+        if constexpr (std::is_same_v<Cell, Sum> || std::is_same_v<Cell, int>) {
+            if constexpr (std::is_same_v<Sum, int8_t>) {
+                switch (active_cpu_level) {
+                    case CpuLevel::AVX512: row_kernel_int8_avx512(row, below, out, width, bits, left_range); return;
+                    case CpuLevel::AVX2: row_kernel_int8_avx2(row, below, out, width, bits, left_range); return;
+                    case CpuLevel::SSE42: row_kernel_int8_sse42(row, below, out, width, bits, left_range); return;
+                    default: break;
+                }
+            } else {
+                switch (active_cpu_level) {
+                    case CpuLevel::AVX512: row_kernel_int16_avx512(row, below, out, width, bits, left_range); return;
+                    case CpuLevel::AVX2: row_kernel_int16_avx2(row, below, out, width, bits, left_range); return;
+                    case CpuLevel::SSE42: row_kernel_int16_sse42(row, below, out, width, bits, left_range); return;
+                    default: break;
+                }
+            }
+        }
+#endif
+        if (bits) std::fill(bits, bits + (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS, 0);
+        row_kernel_narrow_tail(row, below, out, 0, width, bits, left_range);
+        return;
+    }
+
+    for (size_t begin = 0; begin < width; begin += PackedChoiceBits::WORD_BITS) {
+        size_t end = std::min(width, begin + PackedChoiceBits::WORD_BITS);
+        uint64_t word = 0;
+        for (size_t j = begin; j < end; ++j) {
+            bool right = below[j+1] < below[j];
+            out[j] = static_cast<Sum>(row[j] + (right ? below[j+1] : below[j]));
+            word |= static_cast<uint64_t>(right) << (j - begin);
+        }
+        if (bits) bits[begin / PackedChoiceBits::WORD_BITS] = word;
+    }
+}
+
+// Compact solver generic over the cell type and the accumulator type; Sum must hold every partial path sum
+template <typename Cell, typename Sum = typename ValueTypeTraits<Cell>::Sum>
+std::pair<Sum, std::vector<Cell>> minimum_total_typed(const BasicTriangleView<Cell>& triangle, Logger& logger) {
+    logger.info(LogMessages::ALGORITHM_START + " (" + ValueTypeTraits<Cell>::name + " cells, " +
+                ValueTypeTraits<Sum>::name + " sums)");
+
+    if (triangle.empty()) {
+        logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+        return {Sum{}, {}};
+    }
+
+    size_t n = triangle.size();
+    logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+    std::vector<Sum> row_sums(triangle[n-1], triangle[n-1] + n);
+    PackedChoiceBits choices(n - 1);
+    for (size_t i = n - 1; i-- > 0; ) {
+        row_kernel_typed<Cell, Sum>(triangle[i], row_sums.data(), row_sums.data(), i + 1, choices.row_words(i));
+    }
+
+    std::vector<Cell> path = reconstruct_path_from_choices(triangle, choices);
+    logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(row_sums[0]));
+    return {row_sums[0], path};
+}
+
+enum class ValueType { Int8, Int16, Int32, Int64 };
+
+// Narrowest type that holds every cell and every partial path sum of a triangle with these values and rows
+ValueType select_value_type(int min_value, int max_value, size_t rows) {
+    long double low = std::min<long double>(0, static_cast<long double>(min_value) * rows);
+    long double high = std::max<long double>(0, static_cast<long double>(max_value) * rows);
+
+    auto fits = [&](auto type_tag) {
+        using T = decltype(type_tag);
+        return low >= std::numeric_limits<T>::min() && high <= std::numeric_limits<T>::max();
+    };
+
+    if (fits(int8_t{})) return ValueType::Int8;
+    if (fits(int16_t{})) return ValueType::Int16;
+    if (fits(int32_t{})) return ValueType::Int32;
+    return ValueType::Int64;
+}
+
+template <typename Sum> struct WiderSum;
+template <> struct WiderSum<int8_t> { using type = int16_t; };
+template <> struct WiderSum<int16_t> { using type = int32_t; };
+template <> struct WiderSum<int32_t> { using type = int64_t; };
+
+const std::vector<int>& checked_row(const std::vector<std::vector<int>>& triangle, size_t i) {
+    const std::vector<int>& values = triangle[i];
+    if (values.size() != i + 1) {
+        throw std::invalid_argument("Row " + std::to_string(i) + " has " + std::to_string(values.size()) +
+                                    " values, expected " + std::to_string(i + 1));
+    }
+    return values;
+}
+
+// Rows row .. 0, bottom-up, on Work sums kept as OffsetSums<Work> describes. Each row is size-checked, then runs
+// straight from its int values on the row kernel. Narrow rows go into the other row buffer, and one that leaves
+// Work's range is redone in the next wider type from the sums below it, which the buffer swap left untouched.
+// int rows run in place and are checked as in min_path_dp_rows; sums beyond +-2^29 are rare enough that the whole
+// triangle is then redone in int64 rather than keeping a second 4-byte row in cache for a retry
+template <typename Work>
+int64_t solve_narrowed(const std::vector<std::vector<int>>& triangle, size_t row, std::vector<Work> sums,
+                       PackedChoiceBits& choices, Logger& logger) {
+    logger.info("Rows " + std::to_string(row) + " to 0: " + ValueTypeTraits<Work>::name + " sums");
+
+    // The bottom row adds to a row of zeros and has no choices
+    auto row_bits = [&](size_t i) { return i + 1 < triangle.size() ? choices.row_words(i) : nullptr; };
+
+    if constexpr (std::is_same_v<Work, int32_t>) {
+        SumBits seen;
+        for (size_t i = row + 1; i-- > 0; ) {
+            const std::vector<int>& values = checked_row(triangle, i);
+            row_kernel(values.data(), sums.data(), sums.data(), i + 1, row_bits(i), &seen);
+            if (i % 64 == 0 && OffsetSums<int32_t>::outside(static_cast<int32_t>(seen.bits()))) {
+                size_t n = triangle.size();
+                return solve_narrowed(triangle, n - 1, std::vector<int64_t>(n + 1), choices, logger);
+            }
+        }
+        return int64_t{sums[0]} - OffsetSums<int32_t>::OFFSET;
+    }
+
+    std::vector<Work> next(sums.size());
+    for (size_t i = row + 1; i-- > 0; ) {
+        const std::vector<int>& values = checked_row(triangle, i);
+        bool left_range = false;
+        row_kernel_typed<int, Work>(values.data(), sums.data(), next.data(), i + 1, row_bits(i), &left_range);
+
+        if constexpr (!std::is_same_v<Work, int64_t>) {
+            if (left_range) {
+                using Wider = typename WiderSum<Work>::type;
+                std::vector<Wider> wider(sums.size());
+                std::transform(sums.begin(), sums.end(), wider.begin(), [](Work sum) {
+                    return static_cast<Wider>(int64_t{sum} - OffsetSums<Work>::OFFSET + OffsetSums<Wider>::OFFSET);
+                });
+                return solve_narrowed(triangle, i, std::move(wider), choices, logger);
+            }
+        }
+        sums.swap(next);
+    }
+    return int64_t{sums[0]} - OffsetSums<Work>::OFFSET;
+}
+
+// One pass from the bottom row up, starting in int8 lanes and widening the rolling sums only when a row's sums
+// leave the current type, so small values run on narrow SIMD lanes and large triangles accumulate in 64 bits
+// instead of overflowing
+std::pair<int64_t, std::vector<int>> minimum_total_auto(const std::vector<std::vector<int>>& triangle, Logger& logger) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (auto value type)");
+
+        if (triangle_is_empty(triangle)) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        size_t n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        PackedChoiceBits choices(n - 1);
+        std::vector<int8_t> zeros(n + 1, OffsetSums<int8_t>::OFFSET);
+        int64_t min_sum = solve_narrowed(triangle, n - 1, std::move(zeros), choices, logger);
+        std::vector<int> path = reconstruct_path_from_choices(triangle, choices);
+
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in typed minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int64_t>::max(), {}};
+    }
+}
+
+struct ParallelOptions {
+    size_t block_columns = 4096;         // 16 KB of sums per block, multiple of 64 so choice words are not shared
+    size_t min_parallel_width = 32768;   // narrower rows run on the serial kernel
+    size_t band_rows = 64;               // rows advanced between two barriers
+};
+
+// Wide rows are split into column blocks across the pool; narrow rows near the apex are serial. Workers sync once
+// per band of band_rows rows, not once per row: each block also recomputes a halo of up to band_rows columns to its
+// right in private buffers, so within a band it never reads a neighbour's cells. The halo costs
+// band_rows / block_columns extra work (about 1.6% with the defaults)
+std::pair<int, std::vector<int>> minimum_total_parallel(const std::vector<std::vector<int>>& triangle, Logger& logger,
+                                                        ThreadPool& pool = ThreadPool::shared(),
+                                                        const ParallelOptions& options = ParallelOptions()) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (parallel mode)");
+
+        if (triangle.empty() || triangle[0].empty()) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        int n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        if (options.block_columns == 0 || options.block_columns % PackedChoiceBits::WORD_BITS != 0) {
+            throw std::invalid_argument("block_columns must be a positive multiple of 64");
+        }
+        if (options.band_rows == 0) {
+            throw std::invalid_argument("band_rows must be positive");
+        }
+
+        std::vector<int> buffers[2] = {
+            std::vector<int>(triangle[n-1].begin(), triangle[n-1].end()),
+            std::vector<int>(n)
+        };
+        PackedChoiceBits choices(n - 1);
+
+        size_t threads = pool.size();
+        size_t min_width = std::max(options.min_parallel_width, 2 * options.block_columns);
+        int first_serial_row = n - 2;
+        if (threads > 1) {
+            while (first_serial_row >= 0 && triangle[first_serial_row].size() >= min_width) {
+                --first_serial_row;
+            }
+        }
+        int parallel_rows = (n - 2) - first_serial_row;
+        int band_rows = static_cast<int>(std::min<size_t>(options.band_rows, std::max(parallel_rows, 1)));
+        int bands = (parallel_rows + band_rows - 1) / band_rows;
+
+        logger.info("Parallel rows: " + std::to_string(parallel_rows) + " on " + std::to_string(threads) +
+                    " threads in " + std::to_string(bands) + " bands, serial rows: " +
+                    std::to_string(first_serial_row + 1));
+
+        if (parallel_rows > 0) {
+            SpinBarrier barrier(threads);
+            std::atomic<bool> failed{false};
+            std::exception_ptr failure;
+            std::mutex failure_mutex;
+
+            pool.run([&](size_t worker) {
+                std::vector<int> local[2];
+
+                for (int band = 0; band < bands; ++band) {
+                    // A worker that failed, or saw another fail, keeps arriving at the barrier so nobody waits forever
+                    if (!failed.load(std::memory_order_relaxed)) {
+                        try {
+                            int bottom = n - 2 - band * band_rows;
+                            int top = std::max(bottom - band_rows + 1, first_serial_row + 1);
+                            const int* band_input = buffers[band % 2].data();
+                            int* band_output = buffers[(band + 1) % 2].data();
+                            size_t top_width = triangle[top].size();
+                            size_t blocks = (top_width + options.block_columns - 1) / options.block_columns;
+
+                            for (size_t b = worker; b < blocks; b += threads) {
+                                size_t begin = b * options.block_columns;
+                                for (int i = bottom; i >= top; --i) {
+                                    size_t width = triangle[i].size();
+                                    if (width != static_cast<size_t>(i) + 1) {
+                                        throw std::invalid_argument("row " + std::to_string(i) + " has " +
+                                                                    std::to_string(width) + " values");
+                                    }
+                                    size_t owned_end = b + 1 == blocks ? width : begin + options.block_columns;
+                                    size_t halo_end = std::min(owned_end + static_cast<size_t>(i - top), width);
+
+                                    const int* below = i == bottom ? band_input + begin : local[(bottom - i + 1) % 2].data();
+                                    int* out = band_output + begin;
+                                    if (i != top) {
+                                        local[(bottom - i) % 2].resize(options.block_columns + 2 * band_rows + 1);
+                                        out = local[(bottom - i) % 2].data();
+                                    }
+
+                                    row_kernel(triangle[i].data() + begin, below, out, owned_end - begin,
+                                               choices.row_words(i) + begin / PackedChoiceBits::WORD_BITS);
+                                    row_kernel(triangle[i].data() + owned_end, below + (owned_end - begin),
+                                               out + (owned_end - begin), halo_end - owned_end, nullptr);
+                                }
+                            }
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(failure_mutex);
+                            if (!failure) failure = std::current_exception();
+                            failed.store(true, std::memory_order_relaxed);
+                        }
+                    }
+                    barrier.arrive_and_wait();
+                }
+            });
+
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+
+        std::vector<int>& row_sums = buffers[bands % 2];
+        for (int i = first_serial_row; i >= 0; --i) {
+            row_kernel(triangle[i].data(), row_sums.data(), row_sums.data(), triangle[i].size(), choices.row_words(i));
+        }
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path = reconstruct_path_from_choices(triangle, choices);
+
+        int min_sum = row_sums[0];
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in parallel minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+struct TilingOptions {
+    size_t tile_columns = 8192;   // 32 KB of sums stays in L1/L2 while the tile advances
+    size_t tile_rows = 32;
+};
+
+// Temporal blocking: a band of tile_rows rows is processed tile by tile, each tile advancing all rows of the band
+// while its columns are cache resident. Tiles are skewed one column left per row, so every cell only depends on
+// values produced by the same tile or the tile to its left, and a single rolling row of sums is enough.
+std::pair<int, std::vector<int>> minimum_total_tiled(const std::vector<std::vector<int>>& triangle, Logger& logger,
+                                                     const TilingOptions& options = TilingOptions()) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (tiled mode)");
+
+        if (triangle.empty() || triangle[0].empty()) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        int n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        if (options.tile_columns == 0 || options.tile_rows == 0) {
+            throw std::invalid_argument("tile_columns and tile_rows must be positive");
+        }
+
+        std::vector<int> row_sums(triangle[n-1].begin(), triangle[n-1].end());
+        PackedChoiceBits choices(n - 1);
+        std::vector<uint64_t> tile_bits(options.tile_columns / PackedChoiceBits::WORD_BITS + 1);
+
+        logger.info("Tile size: " + std::to_string(options.tile_columns) + " columns x " +
+                    std::to_string(options.tile_rows) + " rows");
+
+        for (size_t base = n - 1; base > 0; ) {
+            size_t band_rows = std::min(options.tile_rows, base);
+            size_t base_width = base + 1;
+
+            for (size_t tile_begin = 0; tile_begin < base_width; tile_begin += options.tile_columns) {
+                size_t tile_end = tile_begin + options.tile_columns;
+
+                for (size_t k = 1; k <= band_rows && k < tile_end; ++k) {
+                    size_t row = base - k;
+                    size_t width = row + 1;
+                    size_t begin = tile_begin >= k ? tile_begin - k : 0;
+                    size_t end = std::min(tile_end - k, width);
+                    if (begin >= end) continue;
+
+                    row_kernel(triangle[row].data() + begin, row_sums.data() + begin, row_sums.data() + begin,
+                               end - begin, tile_bits.data());
+                    choices.assign_range(row, begin, tile_bits.data(), end - begin);
+                }
+            }
+            base -= band_rows;
+        }
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path = reconstruct_path_from_choices(triangle, choices);
+
+        int min_sum = row_sums[0];
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in tiled minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+// Stores the dp row every checkpoint_interval rows (about sqrt(n) by default) instead of choice bits for every cell,
+// then recomputes one block at a time from its checkpoint to follow the path from the apex downward
+std::pair<int, std::vector<int>> minimum_total_checkpointed(const std::vector<std::vector<int>>& triangle, Logger& logger,
+                                                            size_t checkpoint_interval = 0) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (checkpointed mode)");
+
+        if (triangle.empty() || triangle[0].empty()) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        size_t n = triangle.size();
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        if (checkpoint_interval == 0) {
+            checkpoint_interval = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(n)))));
+        }
+
+        // checkpoints[k] holds dp row k * checkpoint_interval; the base row is the triangle itself
+        size_t last_row = n - 1;
+        std::vector<std::vector<int>> checkpoints((last_row + checkpoint_interval - 1) / checkpoint_interval);
+        std::vector<int> row_sums(triangle[last_row].begin(), triangle[last_row].end());
+
+        for (size_t i = last_row; i-- > 0; ) {
+            row_kernel(triangle[i].data(), row_sums.data(), row_sums.data(), triangle[i].size(), nullptr);
+            if (i % checkpoint_interval == 0) {
+                checkpoints[i / checkpoint_interval].assign(row_sums.begin(), row_sums.begin() + i + 1);
+            }
+        }
+        int min_sum = row_sums[0];
+
+        size_t checkpoint_bytes = 0;
+        for (const auto& checkpoint : checkpoints) {
+            checkpoint_bytes += checkpoint.size() * sizeof(int);
+        }
+        logger.info("Checkpoint interval: " + std::to_string(checkpoint_interval) + " rows, checkpoints: " +
+                    std::to_string(checkpoint_bytes) + " bytes");
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path;
+        path.reserve(n);
+        size_t current_col = 0;
+        path.push_back(triangle[0][current_col]);
+
+        std::vector<uint64_t> block_bits;
+        for (size_t block_top = 0; block_top < last_row; block_top += checkpoint_interval) {
+            size_t block_bottom = std::min(block_top + checkpoint_interval, last_row);
+            const std::vector<int>& boundary = block_bottom == last_row
+                ? triangle[last_row] : checkpoints[block_bottom / checkpoint_interval];
+
+            size_t words_per_row = (block_bottom + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS;
+            block_bits.assign((block_bottom - block_top) * words_per_row, 0);
+            row_sums.assign(boundary.begin(), boundary.end());
+
+            for (size_t i = block_bottom; i-- > block_top; ) {
+                row_kernel(triangle[i].data(), row_sums.data(), row_sums.data(), triangle[i].size(),
+                           block_bits.data() + (i - block_top) * words_per_row);
+            }
+
+            for (size_t i = block_top; i < block_bottom; ++i) {
+                const uint64_t* bits = block_bits.data() + (i - block_top) * words_per_row;
+                if ((bits[current_col / PackedChoiceBits::WORD_BITS] >> (current_col % PackedChoiceBits::WORD_BITS)) & 1u) {
+                    current_col += 1;
+                }
+                path.push_back(triangle[i + 1][current_col]);
+            }
+        }
+
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in checkpointed minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+// Parses one text row of whitespace separated integers; returns false on malformed input
+bool parse_triangle_row(const char* begin, const char* end, std::vector<int>& row) {
+    row.clear();
+    const char* p = begin;
+    while (true) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+        if (p == end) return true;
+
+        int value;
+        auto [next, ec] = std::from_chars(p, end, value);
+        if (ec != std::errc() || (next < end && *next != ' ' && *next != '\t' && *next != '\r')) {
+            return false;
+        }
+        row.push_back(value);
+        p = next;
+    }
+}
+
+bool parse_triangle_row(const std::string& line, std::vector<int>& row) {
+    return parse_triangle_row(line.data(), line.data() + line.size(), row);
+}
+
+uint64_t fnv1a_checksum(const void* data, size_t size, uint64_t hash = 14695981039346656037ull) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Binary container: 64-byte header, then the rows packed triangularly as native-endian cells
+struct TriangleFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t value_width;   // bytes per cell
+    uint64_t rows;
+    uint64_t checksum;      // FNV-1a over the packed cells
+    uint8_t reserved[32];
+};
+
+static_assert(sizeof(TriangleFileHeader) == 64, "Triangle file header must keep the cells 64-byte aligned");
+
+const char TRIANGLE_FILE_MAGIC[8] = {'T', 'R', 'I', 'B', 'I', 'N', '\0', '\1'};
+const uint32_t TRIANGLE_FILE_VERSION = 1;
+
+// Bytes of the packed cells of a triangle with this many rows. False when rows * (rows + 1) / 2 * cell_size does
+// not fit size_t, so a corrupt header cannot wrap to a size that matches the file
+bool triangle_payload_bytes(uint64_t rows, size_t cell_size, size_t& bytes) {
+    const size_t limit = std::numeric_limits<size_t>::max();
+    if (rows >= limit) {
+        return false;
+    }
+    size_t half = rows % 2 == 0 ? rows / 2 : rows;
+    size_t other = rows % 2 == 0 ? rows + 1 : (rows + 1) / 2;
+    if (half != 0 && other > limit / half) {
+        return false;
+    }
+    size_t cells = half * other;
+    if (cells > limit / cell_size) {
+        return false;
+    }
+    bytes = cells * cell_size;
+    return true;
+}
+
+// Read-only mapping of a binary triangle file; the cells are used in place
+class MappedTriangle {
+private:
+    void* mapping = MAP_FAILED;
+    size_t mapping_size = 0;
+    TriangleFileHeader file_header{};
+    TriangleView triangle_view;
+
+public:
+    explicit MappedTriangle(const std::string& filename, bool verify_checksum = true) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("File not found: " + filename);
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(TriangleFileHeader)) {
+            ::close(fd);
+            throw std::runtime_error("File too small for a triangle header: " + filename);
+        }
+
+        mapping_size = info.st_size;
+        mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::runtime_error("Cannot map file: " + filename);
+        }
+
+        try {
+            std::memcpy(&file_header, mapping, sizeof(file_header));
+            if (std::memcmp(file_header.magic, TRIANGLE_FILE_MAGIC, sizeof(TRIANGLE_FILE_MAGIC)) != 0) {
+                throw std::runtime_error("Not a binary triangle file: " + filename);
+            }
+            if (file_header.version != TRIANGLE_FILE_VERSION || file_header.value_width != sizeof(int)) {
+                throw std::runtime_error("Unsupported triangle file version or value width: " + filename);
+            }
+
+            size_t payload = 0;
+            if (!triangle_payload_bytes(file_header.rows, sizeof(int), payload) ||
+                mapping_size - sizeof(TriangleFileHeader) != payload) {
+                throw std::runtime_error("Triangle file size does not match its header: " + filename);
+            }
+
+            const char* cells = static_cast<const char*>(mapping) + sizeof(TriangleFileHeader);
+            if (verify_checksum && fnv1a_checksum(cells, payload) != file_header.checksum) {
+                throw std::runtime_error("Triangle file checksum mismatch: " + filename);
+            }
+
+            triangle_view.cells = reinterpret_cast<const int*>(cells);
+            triangle_view.rows = file_header.rows;
+        } catch (...) {
+            ::munmap(mapping, mapping_size);
+            throw;
+        }
+    }
+
+    ~MappedTriangle() {
+        if (mapping != MAP_FAILED) {
+            ::munmap(mapping, mapping_size);
+        }
+    }
+
+    MappedTriangle(const MappedTriangle&) = delete;
+    MappedTriangle& operator=(const MappedTriangle&) = delete;
+
+    const TriangleView& view() const {
+        return triangle_view;
+    }
+
+    const TriangleFileHeader& header() const {
+        return file_header;
+    }
+
+    // Starts reading rows [first_row, last_row) in the background; the range is widened to whole pages
+    void prefetch_rows(size_t first_row, size_t last_row) const {
+        advise_range(first_row, last_row, MADV_WILLNEED, false);
+    }
+
+    // Drops the pages of rows [first_row, last_row) from this process; only pages entirely inside the range
+    // are released, later access faults them back in from the file
+    void release_rows(size_t first_row, size_t last_row) const {
+        advise_range(first_row, last_row, MADV_DONTNEED, true);
+    }
+
+private:
+    void advise_range(size_t first_row, size_t last_row, int advice, bool shrink_to_pages) const {
+        if (first_row >= last_row) return;
+
+        size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        uintptr_t base = reinterpret_cast<uintptr_t>(mapping);
+        uintptr_t begin = reinterpret_cast<uintptr_t>(triangle_view.cells + TriangleView::row_offset(first_row));
+        uintptr_t end = reinterpret_cast<uintptr_t>(triangle_view.cells + TriangleView::row_offset(last_row));
+        end = std::min(end, base + mapping_size);
+
+        if (shrink_to_pages) {
+            begin = (begin + page - 1) / page * page;
+            end = end == base + mapping_size ? (end + page - 1) / page * page : end / page * page;
+        } else {
+            begin = begin / page * page;
+            end = (end + page - 1) / page * page;
+        }
+        if (begin < end) {
+            ::madvise(reinterpret_cast<void*>(begin), end - begin, advice);
+        }
+    }
+};
+
+class TriangleFileReader {
+private:
+    Logger& logger;
+
+public:
+    TriangleFileReader(Logger& log) : logger(log) {}
+
+    static bool is_binary_file(const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        char magic[sizeof(TRIANGLE_FILE_MAGIC)] = {};
+        file.read(magic, sizeof(magic));
+        return file && std::memcmp(magic, TRIANGLE_FILE_MAGIC, sizeof(magic)) == 0;
+    }
+
+    // Text format: one row per line, row i holds i + 1 integers; empty lines are skipped
+    std::vector<std::vector<int>> read_text(const std::string& filename) {
+        logger.info("Attempting to read triangle from text file: " + filename);
+
+        std::ifstream file(filename);
+        if (!file.is_open()) {
+            logger.error("Input file not found: " + filename);
+            throw std::runtime_error("File not found: " + filename);
+        }
+
+        std::vector<std::vector<int>> triangle;
+        std::string line;
+        std::vector<int> row;
+        int lines_read = 0;
+
+        while (std::getline(file, line)) {
+            lines_read++;
+            if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+            if (!parse_triangle_row(line, row)) {
+                logger.error("Invalid row data at line " + std::to_string(lines_read) + ": " + line);
+                throw std::runtime_error("Invalid row data");
+            }
+            if (row.size() != triangle.size() + 1) {
+                logger.error("Row at line " + std::to_string(lines_read) + " has " + std::to_string(row.size()) +
+                             " elements, expected " + std::to_string(triangle.size() + 1));
+                throw std::runtime_error("Invalid triangle shape");
+            }
+            triangle.push_back(row);
+        }
+
+        logger.info("Successfully read " + std::to_string(triangle.size()) + " rows from file");
+        return triangle;
+    }
+
+    void write_text(const std::string& filename, const std::vector<std::vector<int>>& triangle) {
+        std::ofstream file(filename);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open output file: " + filename);
+        }
+        for (const auto& row : triangle) {
+            for (size_t j = 0; j < row.size(); ++j) {
+                if (j > 0) file << ' ';
+                file << row[j];
+            }
+            file << '\n';
+        }
+        logger.info("Wrote " + std::to_string(triangle.size()) + " rows to text file: " + filename);
+    }
+
+    void write_binary(const std::string& filename, const std::vector<std::vector<int>>& triangle) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open output file: " + filename);
+        }
+
+        TriangleFileHeader header = make_header(triangle.size());
+        for (size_t i = 0; i < triangle.size(); ++i) {
+            if (triangle[i].size() != i + 1) {
+                throw std::invalid_argument("Row " + std::to_string(i) + " is not triangular");
+            }
+            header.checksum = fnv1a_checksum(triangle[i].data(), triangle[i].size() * sizeof(int), header.checksum);
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& row : triangle) {
+            file.write(reinterpret_cast<const char*>(row.data()), row.size() * sizeof(int));
+        }
+        if (!file) {
+            throw std::runtime_error("Failed to write triangle file: " + filename);
+        }
+        logger.info("Wrote " + std::to_string(triangle.size()) + " rows to binary file: " + filename);
+    }
+
+    void write_binary(const std::string& filename, const TriangleView& triangle) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open output file: " + filename);
+        }
+
+        size_t payload = TriangleView::cell_count(triangle.size()) * sizeof(int);
+        TriangleFileHeader header = make_header(triangle.size());
+        header.checksum = fnv1a_checksum(triangle.cells, payload);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(triangle.cells), payload);
+        if (!file) {
+            throw std::runtime_error("Failed to write triangle file: " + filename);
+        }
+        logger.info("Wrote " + std::to_string(triangle.size()) + " rows to binary file: " + filename);
+    }
+
+private:
+    static TriangleFileHeader make_header(size_t rows) {
+        TriangleFileHeader header{};
+        std::memcpy(header.magic, TRIANGLE_FILE_MAGIC, sizeof(TRIANGLE_FILE_MAGIC));
+        header.version = TRIANGLE_FILE_VERSION;
+        header.value_width = sizeof(int);
+        header.rows = rows;
+        header.checksum = fnv1a_checksum(nullptr, 0);
+        return header;
+    }
+};
+
+// Top-down solver fed one row at a time; keeps two rows of best sums and, optionally, one bit per interior cell
+class StreamingTriangleSolver {
+private:
+    std::vector<int> best;
+    std::vector<int> next_best;
+    PackedChoiceBits choices;   // row i >= 2 stores its interior cells 1..i-1 in choice row i-2, bit set = came straight down
+    size_t rows = 0;
+    size_t best_col = 0;        // leftmost minimum of the current base
+    bool track_path;
+
+public:
+    explicit StreamingTriangleSolver(bool track = false) : track_path(track) {}
+
+    void push_row(const int* values, size_t count) {
+        if (count != rows + 1) {
+            throw std::invalid_argument("Row " + std::to_string(rows) + " has " + std::to_string(count) +
+                                        " elements, expected " + std::to_string(rows + 1));
+        }
+
+        // The kernel reports the interior's leftmost minimum, so the new base is not scanned again; the edge
+        // cells are compared around it in column order
+        next_best.resize(count);
+        best_col = 0;
+        if (rows == 0) {
+            next_best[0] = values[0];
+        } else {
+            uint64_t* bits = nullptr;
+            if (track_path && rows >= 2) {
+                choices.append_row();
+                bits = choices.row_words(rows - 2);
+            }
+            next_best[0] = values[0] + best[0];
+            if (rows >= 2) {
+                RowMinimum interior;
+                row_kernel(values + 1, best.data(), next_best.data() + 1, rows - 1, bits, nullptr, &interior);
+                auto [interior_min, interior_col] = interior.leftmost();
+                if (interior_min < next_best[0]) best_col = interior_col + 1;
+            }
+            next_best[rows] = values[rows] + best[rows - 1];
+            if (next_best[rows] < next_best[best_col]) best_col = rows;
+        }
+
+        best.swap(next_best);
+        ++rows;
+    }
+
+    void push_row(const std::vector<int>& row) {
+        push_row(row.data(), row.size());
+    }
+
+    size_t row_count() const {
+        return rows;
+    }
+
+    int minimum_sum() const {
+        if (rows == 0) return 0;
+        return best[best_col];
+    }
+
+    // Leftmost minimum at the base and left parent on ties give the same path as minimum_total
+    std::vector<size_t> path_columns() const {
+        if (!track_path) {
+            throw std::logic_error("Path tracking is disabled for this solver");
+        }
+        if (rows == 0) return {};
+
+        std::vector<size_t> columns(rows);
+        size_t col = best_col;
+        for (size_t i = rows - 1; i > 0; --i) {
+            columns[i] = col;
+            if (col == i || (col > 0 && !choices.get(i - 2, col - 1))) {
+                col -= 1;
+            }
+        }
+        columns[0] = 0;
+        return columns;
+    }
+
+    size_t memory_bytes() const {
+        return (best.capacity() + next_best.capacity()) * sizeof(int) + choices.memory_bytes();
+    }
+};
+
+// Triangle that grows by appending base rows: each append costs O(row length) and updates the minimum at once,
+// the path is rebuilt only when asked for and cached until the next append. Each row is copied once, into the
+// rows kept for that rebuild
+class OnlineTriangleSolver {
+private:
+    StreamingTriangleSolver state{true};
+    std::vector<std::vector<int>> triangle;
+    mutable std::vector<int> cached_path;
+    mutable bool path_valid = false;
+
+public:
+    int append_row(const int* values, size_t count) {
+        state.push_row(values, count);
+        triangle.emplace_back(values, values + count);
+        path_valid = false;
+        return state.minimum_sum();
+    }
+
+    int append_row(const std::vector<int>& row) {
+        return append_row(row.data(), row.size());
+    }
+
+    size_t row_count() const {
+        return state.row_count();
+    }
+
+    int minimum_sum() const {
+        return state.minimum_sum();
+    }
+
+    const std::vector<int>& path() const {
+        if (!path_valid) {
+            std::vector<size_t> columns = state.path_columns();
+            cached_path.resize(columns.size());
+            for (size_t i = 0; i < columns.size(); ++i) {
+                cached_path[i] = triangle[i][columns[i]];
+            }
+            path_valid = true;
+        }
+        return cached_path;
+    }
+};
+
+// next_row fills the vector with the next row and returns false when the stream is exhausted
+std::pair<int, std::vector<size_t>> minimum_total_stream(const std::function<bool(std::vector<int>&)>& next_row,
+                                                         Logger& logger, bool track_path = true) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (streaming mode)");
+
+        StreamingTriangleSolver solver(track_path);
+        std::vector<int> row;
+        while (next_row(row)) {
+            solver.push_row(row);
+        }
+
+        if (solver.row_count() == 0) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(solver.row_count()) + " rows");
+        logger.info("Streaming state size: " + std::to_string(solver.memory_bytes()) + " bytes");
+
+        int min_sum = solver.minimum_sum();
+        std::vector<size_t> columns = track_path ? solver.path_columns() : std::vector<size_t>();
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+
+        return {min_sum, columns};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in streaming minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+// Text input, one row per line; empty lines are skipped
+std::pair<int, std::vector<size_t>> minimum_total_stream_file(const std::string& filename, Logger& logger,
+                                                              bool track_path = true) {
+    logger.info("Streaming triangle rows from file: " + filename);
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        logger.error("Input file not found: " + filename);
+        return {std::numeric_limits<int>::max(), {}};
+    }
+
+    std::string line;
+    return minimum_total_stream([&](std::vector<int>& row) {
+        while (std::getline(file, line)) {
+            if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+
+            if (!parse_triangle_row(line, row)) {
+                throw std::runtime_error("Invalid row data: " + line);
+            }
+            return true;
+        }
+        return false;
+    }, logger, track_path);
+}
+
+// Choice bits spilled to an unlinked temporary file in the PackedChoiceBits row layout. Rows arrive from the
+// base upward, so the write buffer is filled from its end and flushed as one contiguous block
+class ChoiceSpillFile {
+private:
+    int fd = -1;
+    std::vector<uint64_t> buffer;
+    size_t fill_start;        // buffer[fill_start, size) holds rows starting at buffered_row
+    size_t buffered_row = 0;
+    size_t written_bytes = 0;
+
+    void write_words(const uint64_t* words, size_t count, size_t word_offset) {
+        const char* data = reinterpret_cast<const char*>(words);
+        size_t bytes = count * sizeof(uint64_t);
+        off_t offset = static_cast<off_t>(word_offset * sizeof(uint64_t));
+        while (bytes > 0) {
+            ssize_t done = ::pwrite(fd, data, bytes, offset);
+            if (done <= 0) {
+                throw std::runtime_error("Cannot write choice spill file");
+            }
+            data += done;
+            bytes -= done;
+            offset += done;
+            written_bytes += done;
+        }
+    }
+
+public:
+    ChoiceSpillFile(const std::string& directory, size_t buffer_words)
+        : buffer(std::max<size_t>(buffer_words, 1)), fill_start(buffer.size()) {
+        std::string pattern = (std::filesystem::path(directory) / "triangle_choices_XXXXXX").string();
+        fd = ::mkstemp(pattern.data());
+        if (fd < 0) {
+            throw std::runtime_error("Cannot create choice spill file in " + directory);
+        }
+        ::unlink(pattern.c_str());
+    }
+
+    ~ChoiceSpillFile() {
+        if (fd >= 0) ::close(fd);
+    }
+
+    ChoiceSpillFile(const ChoiceSpillFile&) = delete;
+    ChoiceSpillFile& operator=(const ChoiceSpillFile&) = delete;
+
+    // Rows must be pushed in descending order
+    void push_row(size_t row, const uint64_t* words) {
+        size_t count = row / PackedChoiceBits::WORD_BITS + 1;
+        if (count > fill_start) flush();
+        if (count > buffer.size()) {
+            write_words(words, count, PackedChoiceBits::row_word_offset(row));
+            return;
+        }
+        fill_start -= count;
+        std::copy(words, words + count, buffer.begin() + fill_start);
+        buffered_row = row;
+    }
+
+    void flush() {
+        if (fill_start == buffer.size()) return;
+        write_words(buffer.data() + fill_start, buffer.size() - fill_start, PackedChoiceBits::row_word_offset(buffered_row));
+        fill_start = buffer.size();
+    }
+
+    bool get(size_t row, size_t col) const {
+        uint64_t word = 0;
+        size_t word_offset = PackedChoiceBits::row_word_offset(row) + col / PackedChoiceBits::WORD_BITS;
+        if (::pread(fd, &word, sizeof(word), static_cast<off_t>(word_offset * sizeof(uint64_t))) != sizeof(word)) {
+            throw std::runtime_error("Cannot read choice spill file");
+        }
+        return (word >> (col % PackedChoiceBits::WORD_BITS)) & 1u;
+    }
+
+    size_t file_bytes() const {
+        return written_bytes;
+    }
+
+    size_t buffer_bytes() const {
+        return buffer.size() * sizeof(uint64_t);
+    }
+};
+
+struct OutOfCoreOptions {
+    size_t memory_limit_bytes = size_t{1} << 30;   // dp row + choice bits or spill buffer + input window
+    size_t readahead_bytes = size_t{64} << 20;     // rows prefetched ahead of the sweep, clamped to the budget
+    size_t spill_buffer_bytes = size_t{4} << 20;
+    std::string spill_directory = std::filesystem::temp_directory_path().string();
+};
+
+// Resident set of this process from /proc/self/statm, 0 where unavailable
+size_t resident_memory_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (!(statm >> total_pages >> resident_pages)) return 0;
+    return resident_pages * static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+// Peak resident set (VmHWM) of this process image, 0 where unavailable
+size_t peak_resident_memory_bytes() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0) {
+            return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+        }
+    }
+    return 0;
+}
+
+// Solves a binary triangle file larger than RAM: the file is mapped, rows are swept from the base upward with
+// one in-place dp row, the rows ahead are prefetched with MADV_WILLNEED and finished rows are dropped with
+// MADV_DONTNEED. Choice bits stay in memory when they fit under the limit and are spilled to disk otherwise
+std::pair<int, std::vector<int>> minimum_total_out_of_core(const std::string& filename, Logger& logger,
+                                                           const OutOfCoreOptions& options = OutOfCoreOptions()) {
+    try {
+        logger.info(LogMessages::ALGORITHM_START + " (out-of-core mode)");
+
+        MappedTriangle mapped(filename, false);
+        const TriangleView& triangle = mapped.view();
+        if (triangle.empty()) {
+            logger.warning(LogMessages::ALGORITHM_EMPTY_INPUT);
+            return {0, {}};
+        }
+
+        size_t n = triangle.size();
+        size_t last_row = n - 1;
+        logger.info(LogMessages::TRIANGLE_SIZE + std::to_string(n) + " rows");
+
+        size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t dp_bytes = 2 * n * sizeof(int);   // dp row and the path
+        size_t choice_bytes = PackedChoiceBits::row_word_offset(last_row) * sizeof(uint64_t);
+        if (options.memory_limit_bytes < dp_bytes + 4 * page) {
+            throw std::runtime_error("Memory limit of " + std::to_string(options.memory_limit_bytes) +
+                                     " bytes cannot hold the dp row and path of " + std::to_string(dp_bytes) + " bytes");
+        }
+        size_t budget = options.memory_limit_bytes - dp_bytes;
+
+        // Choice bits in memory if they leave at least half of the budget for the input window
+        bool spill = choice_bytes > budget / 2;
+        PackedChoiceBits choices(spill ? 0 : last_row);
+        std::unique_ptr<ChoiceSpillFile> spill_file;
+        std::vector<uint64_t> row_bits;
+        if (spill) {
+            size_t buffer_bytes = std::min(options.spill_buffer_bytes, budget / 4);
+            spill_file = std::make_unique<ChoiceSpillFile>(options.spill_directory, buffer_bytes / sizeof(uint64_t));
+            row_bits.resize(last_row / PackedChoiceBits::WORD_BITS + 1);
+            budget -= spill_file->buffer_bytes();
+        } else {
+            budget -= choice_bytes;
+        }
+
+        // Half of the window is prefetched ahead of the sweep, half is finished rows awaiting release
+        size_t window_bytes = std::max(page, std::min(options.readahead_bytes, budget / 2));
+        logger.info("Memory limit: " + std::to_string(options.memory_limit_bytes) + " bytes, dp row and path: " +
+                    std::to_string(dp_bytes) + " bytes, choices: " +
+                    (spill ? "spilled to disk (" + std::to_string(choice_bytes) + " bytes)"
+                           : "in memory (" + std::to_string(choice_bytes) + " bytes)") +
+                    ", readahead window: " + std::to_string(window_bytes) + " bytes");
+
+        std::vector<int> row_sums(triangle[last_row], triangle[last_row] + n);
+        size_t released_from = n;     // rows [released_from, n) were already dropped
+        size_t prefetched_to = last_row;
+
+        for (size_t i = last_row; i-- > 0; ) {
+            if (i < prefetched_to) {
+                size_t first = i;
+                size_t bytes = (i + 1) * sizeof(int);
+                while (first > 0 && bytes < window_bytes) {
+                    --first;
+                    bytes += (first + 1) * sizeof(int);
+                }
+                mapped.prefetch_rows(first, i + 1);
+                prefetched_to = first;
+            }
+
+            uint64_t* bits = spill ? row_bits.data() : choices.row_words(i);
+            row_kernel(triangle[i], row_sums.data(), row_sums.data(), i + 1, bits);
+            if (spill) spill_file->push_row(i, bits);
+
+            size_t finished_bytes = (TriangleView::row_offset(released_from) - TriangleView::row_offset(i + 1)) * sizeof(int);
+            if (finished_bytes >= window_bytes) {
+                mapped.release_rows(i + 1, released_from);
+                released_from = i + 1;
+            }
+        }
+        mapped.release_rows(0, released_from);
+        if (spill) spill_file->flush();
+        int min_sum = row_sums[0];
+
+        logger.info(LogMessages::PATH_RECONSTRUCTION_START);
+        std::vector<int> path;
+        path.reserve(n);
+        size_t col = 0;
+        path.push_back(triangle[0][0]);
+        size_t touched_from = 0;
+        for (size_t i = 0; i < last_row; ++i) {
+            if (spill ? spill_file->get(i, col) : choices.get(i, col)) {
+                col += 1;
+            }
+            path.push_back(triangle[i + 1][col]);
+
+            // The path touches one page per row; drop them as the walk goes down
+            if ((TriangleView::row_offset(i + 1) - TriangleView::row_offset(touched_from)) * sizeof(int) >= window_bytes) {
+                mapped.release_rows(touched_from, i + 1);
+                touched_from = i + 1;
+            }
+        }
+
+        logger.info("Out-of-core solve done, resident set: " + std::to_string(resident_memory_bytes()) +
+                    " bytes" + (spill ? ", spill file: " + std::to_string(spill_file->file_bytes()) + " bytes" : ""));
+        logger.info(LogMessages::ALGORITHM_COMPLETE + std::to_string(min_sum));
+        logger.info(LogMessages::PATH_COMPLETE + std::string(format_path(path)));
+
+        return {min_sum, path};
+
+    } catch (const std::exception& error) {
+        logger.error("Error in out-of-core minimum path calculation: " + std::string(error.what()));
+        return {std::numeric_limits<int>::max(), {}};
+    }
+}
+
+struct CellUpdate {
+    size_t row;
+    size_t col;
+    int value;
+};
+
+// Keeps the bottom-up dp table between queries; an update only recomputes the cone above the changed cells
+// and stops as soon as a row comes out unchanged
+class IncrementalTriangleSolver {
+private:
+    std::vector<std::vector<int>> triangle;
+    std::vector<std::vector<int>> dp;
+    size_t recomputed_cells = 0;
+
+    int cell_value(size_t row, size_t col) const {
+        if (row + 1 == triangle.size()) return triangle[row][col];
+        return triangle[row][col] + std::min(dp[row+1][col], dp[row+1][col+1]);
+    }
+
+public:
+    explicit IncrementalTriangleSolver(std::vector<std::vector<int>> initial) : triangle(std::move(initial)) {
+        if (triangle_is_empty(triangle)) {
+            throw std::invalid_argument("Incremental solver needs a non-empty triangle");
+        }
+
+        dp.resize(triangle.size());
+        for (size_t i = triangle.size(); i-- > 0; ) {
+            if (triangle[i].size() != i + 1) {
+                throw std::invalid_argument("Row " + std::to_string(i) + " is not triangular");
+            }
+            dp[i].resize(i + 1);
+            for (size_t j = 0; j <= i; ++j) {
+                dp[i][j] = cell_value(i, j);
+            }
+        }
+        recomputed_cells = TriangleView::cell_count(triangle.size());
+    }
+
+    std::pair<int, std::vector<int>> update(size_t row, size_t col, int value) {
+        return update(std::vector<CellUpdate>{{row, col, value}});
+    }
+
+    std::pair<int, std::vector<int>> update(std::vector<CellUpdate> updates) {
+        for (const auto& cell : updates) {
+            if (cell.row >= triangle.size() || cell.col > cell.row) {
+                throw std::out_of_range("Cell (" + std::to_string(cell.row) + ", " + std::to_string(cell.col) +
+                                        ") is outside the triangle");
+            }
+            triangle[cell.row][cell.col] = cell.value;
+        }
+        std::sort(updates.begin(), updates.end(), [](const CellUpdate& a, const CellUpdate& b) { return a.row > b.row; });
+
+        recomputed_cells = 0;
+        size_t next_update = 0;
+        bool changed_below = false;
+        size_t changed_lo = 0;
+        size_t changed_hi = 0;
+        size_t row = updates.empty() ? 0 : updates[0].row;
+
+        while (true) {
+            bool dirty = changed_below;
+            size_t lo = changed_lo > 0 ? changed_lo - 1 : 0;
+            size_t hi = std::min(changed_hi, row);
+            for (; next_update < updates.size() && updates[next_update].row == row; ++next_update) {
+                size_t col = updates[next_update].col;
+                lo = dirty ? std::min(lo, col) : col;
+                hi = dirty ? std::max(hi, col) : col;
+                dirty = true;
+            }
+
+            changed_below = false;
+            if (dirty) {
+                for (size_t j = lo; j <= hi; ++j) {
+                    int value = cell_value(row, j);
+                    ++recomputed_cells;
+                    if (value != dp[row][j]) {
+                        dp[row][j] = value;
+                        if (!changed_below) changed_lo = j;
+                        changed_hi = j;
+                        changed_below = true;
+                    }
+                }
+            }
+
+            if (row == 0) break;
+            if (changed_below) {
+                --row;
+            } else if (next_update < updates.size()) {
+                row = updates[next_update].row;
+            } else {
+                break;
+            }
+        }
+
+        return {minimum_sum(), path()};
+    }
+
+    int minimum_sum() const {
+        return dp[0][0];
+    }
+
+    std::vector<int> path() const {
+        std::vector<int> result;
+        result.reserve(triangle.size());
+        size_t current_col = 0;
+        result.push_back(triangle[0][current_col]);
+        for (size_t i = 1; i < triangle.size(); ++i) {
+            if (dp[i][current_col+1] < dp[i][current_col]) {
+                current_col += 1;
+            }
+            result.push_back(triangle[i][current_col]);
+        }
+        return result;
+    }
+
+    size_t last_recomputed_cells() const {
+        return recomputed_cells;
+    }
+};
+
+// Semirings for the triangle recurrence value(i, j) = cell(i, j) * (value(i+1, j) + value(i+1, j+1))
+struct MinPlusSemiring {
+    using Value = int64_t;
+    static Value from_cell(int cell) { return cell; }
+    static Value plus(Value a, Value b) { return std::min(a, b); }
+    static Value times(Value a, Value b) { return a + b; }
+};
+
+struct MaxPlusSemiring {
+    using Value = int64_t;
+    static Value from_cell(int cell) { return cell; }
+    static Value plus(Value a, Value b) { return std::max(a, b); }
+    static Value times(Value a, Value b) { return a + b; }
+};
+
+// Number of paths modulo Modulus
+template <uint64_t Modulus = 1000000007>
+struct CountingSemiring {
+    using Value = uint64_t;
+    static Value from_cell(int) { return 1; }
+    static Value plus(Value a, Value b) { return (a + b) % Modulus; }
+    static Value times(Value a, Value b) { return (a * b) % Modulus; }
+};
+
+// Minimum sum together with the number of paths reaching it, modulo Modulus
+template <uint64_t Modulus = 1000000007>
+struct MinPlusCountSemiring {
+    struct Value {
+        int64_t sum;
+        uint64_t count;
+        bool operator==(const Value& other) const { return sum == other.sum && count == other.count; }
+    };
+    static Value from_cell(int cell) { return {cell, 1}; }
+    static Value plus(Value a, Value b) {
+        if (a.sum != b.sum) return a.sum < b.sum ? a : b;
+        return {a.sum, (a.count + b.count) % Modulus};
+    }
+    static Value times(Value a, Value b) { return {a.sum + b.sum, (a.count * b.count) % Modulus}; }
+};
+
+template <typename Semiring>
+inline void semiring_cell(int cell, const std::vector<typename Semiring::Value>& below,
+                          std::vector<typename Semiring::Value>& out, size_t j) {
+    out[j] = Semiring::times(Semiring::from_cell(cell), Semiring::plus(below[j], below[j+1]));
+}
+
+template <typename... Semirings, typename Triangle, size_t... Is>
+std::tuple<typename Semirings::Value...> triangle_semiring_fused_impl(const Triangle& triangle, std::index_sequence<Is...>) {
+    size_t n = triangle.size();
+    const int* base = row_pointer(triangle, n - 1);
+
+    std::tuple<std::vector<typename Semirings::Value>...> rows;
+    ((std::get<Is>(rows).resize(n)), ...);
+    for (size_t j = 0; j < n; ++j) {
+        ((std::get<Is>(rows)[j] = Semirings::from_cell(base[j])), ...);
+    }
+
+    for (size_t i = n - 1; i-- > 0; ) {
+        const int* row = row_pointer(triangle, i);
+        for (size_t j = 0; j <= i; ++j) {
+            int cell = row[j];
+            (semiring_cell<Semirings>(cell, std::get<Is>(rows), std::get<Is>(rows), j), ...);
+        }
+    }
+
+    return {std::get<Is>(rows)[0]...};
+}
+
+// Evaluates several semirings in one pass, so every cell is read from memory once for all of them
+template <typename... Semirings, typename Triangle>
+std::tuple<typename Semirings::Value...> triangle_semiring_fused(const Triangle& triangle) {
+    if (triangle_is_empty(triangle)) {
+        throw std::invalid_argument("Semiring evaluation needs a non-empty triangle");
+    }
+    return triangle_semiring_fused_impl<Semirings...>(triangle, std::index_sequence_for<Semirings...>{});
+}
+
+template <typename Semiring, typename Triangle>
+typename Semiring::Value triangle_semiring(const Triangle& triangle) {
+    return std::get<0>(triangle_semiring_fused<Semiring>(triangle));
+}
+
+// Triangle with a compile-time shape: Rows rows packed row by row into one std::array
+template <size_t Rows>
+struct FixedTriangle {
+    static_assert(Rows > 0, "A fixed triangle needs at least one row");
+    static constexpr size_t cell_count = Rows * (Rows + 1) / 2;
+
+    std::array<int, cell_count> cells;
+
+    static constexpr size_t offset(size_t row) { return row * (row + 1) / 2; }
+    constexpr int at(size_t row, size_t col) const { return cells[offset(row) + col]; }
+
+    std::vector<std::vector<int>> to_nested() const {
+        std::vector<std::vector<int>> triangle(Rows);
+        for (size_t row = 0; row < Rows; ++row) {
+            triangle[row].assign(cells.begin() + offset(row), cells.begin() + offset(row + 1));
+        }
+        return triangle;
+    }
+};
+
+template <size_t Rows>
+struct FixedPathResult {
+    int sum;
+    std::array<int, Rows> path;
+    std::array<size_t, Rows> columns;
+};
+
+// One row of the bottom-up pass; the fold expands to straight-line code, one min/add per column. Writing sums[J]
+// before reading sums[J + 1] is safe because column J + 1 of the row below is still untouched
+template <size_t Rows, size_t Row, size_t... J>
+constexpr void fixed_row_step(const FixedTriangle<Rows>& triangle, std::array<int, Rows>& sums,
+                              std::array<bool, FixedTriangle<Rows>::cell_count>& right, std::index_sequence<J...>) {
+    ((right[FixedTriangle<Rows>::offset(Row) + J] = sums[J + 1] < sums[J],
+      sums[J] = triangle.cells[FixedTriangle<Rows>::offset(Row) + J] +
+                (right[FixedTriangle<Rows>::offset(Row) + J] ? sums[J + 1] : sums[J])), ...);
+}
+
+template <size_t Rows, size_t... Step>
+constexpr void fixed_rows(const FixedTriangle<Rows>& triangle, std::array<int, Rows>& sums,
+                          std::array<bool, FixedTriangle<Rows>::cell_count>& right, std::index_sequence<Step...>) {
+    (fixed_row_step<Rows, Rows - 2 - Step>(triangle, sums, right, std::make_index_sequence<Rows - 1 - Step>{}), ...);
+}
+
+// constexpr counterpart of minimum_total for small fixed shapes: same sum and same path (left on ties), no logging
+// and no allocation. Every row and column is unrolled, so keep Rows to a few dozen
+template <size_t Rows>
+constexpr FixedPathResult<Rows> minimum_total_fixed(const FixedTriangle<Rows>& triangle) {
+    std::array<int, Rows> sums{};
+    std::array<bool, FixedTriangle<Rows>::cell_count> right{};
+    for (size_t col = 0; col < Rows; ++col) {
+        sums[col] = triangle.at(Rows - 1, col);
+    }
+    fixed_rows(triangle, sums, right, std::make_index_sequence<Rows - 1>{});
+
+    FixedPathResult<Rows> result{sums[0], {}, {}};
+    size_t col = 0;
+    for (size_t row = 0; row < Rows; ++row) {
+        result.columns[row] = col;
+        result.path[row] = triangle.at(row, col);
+        col += right[FixedTriangle<Rows>::offset(row) + col] ? 1 : 0;
+    }
+    return result;
+}
+
+// Path as one direction bit per row step: bit r set = went right from row r to row r + 1
+struct RankedPath {
+    int sum = 0;
+    std::vector<uint64_t> directions;
+
+    bool went_right(size_t row) const {
+        return (directions[row / PackedChoiceBits::WORD_BITS] >> (row % PackedChoiceBits::WORD_BITS)) & 1u;
+    }
+
+    size_t column(size_t row) const {
+        size_t col = 0;
+        for (size_t r = 0; r < row; ++r) {
+            col += went_right(r);
+        }
+        return col;
+    }
+
+    CompactPath compact(size_t rows) const {
+        return CompactPath(rows, sum, directions);
+    }
+};
+
+// Lazy best-first enumeration over the bottom-up dp table. Each found path is the greedy (dp-optimal) completion
+// of a deviation from an earlier path; the alternatives along its new tail are candidates keyed by their exact
+// best sum. Only the k - found best candidates can still be emitted, so the candidate set is capped at that size
+// and the k paths come out in nondecreasing order in O(n^2 + k * n log k).
+std::vector<RankedPath> k_best_paths(const std::vector<std::vector<int>>& triangle, size_t k, Logger& logger) {
+    std::vector<RankedPath> found;
+    try {
+        logger.info("Searching for " + std::to_string(k) + " best paths");
+
+        if (triangle_is_empty(triangle) || k == 0) {
+            return found;
+        }
+
+        // Every partial and full path sum is bounded by n * max|value|, so int holds all of them when that does
+        size_t n = triangle.size();
+        int64_t max_abs = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (triangle[i].size() != i + 1) {
+                throw std::invalid_argument("Row " + std::to_string(i) + " has " + std::to_string(triangle[i].size()) +
+                                            " values, expected " + std::to_string(i + 1));
+            }
+            for (int value : triangle[i]) {
+                max_abs = std::max(max_abs, std::abs(static_cast<int64_t>(value)));
+            }
+        }
+        if (max_abs > std::numeric_limits<int>::max() / static_cast<int64_t>(n)) {
+            throw std::overflow_error("Path sums of " + std::to_string(n) + " rows with values up to " +
+                                      std::to_string(max_abs) + " may not fit in int");
+        }
+
+        std::vector<int> dp(TriangleView::cell_count(n));
+        auto dp_row = [&](size_t r) { return dp.data() + TriangleView::row_offset(r); };
+        std::copy(triangle[n-1].begin(), triangle[n-1].end(), dp_row(n - 1));
+        for (size_t i = n - 1; i-- > 0; ) {
+            const int* below = dp_row(i + 1);
+            int* sums = dp_row(i);
+            for (size_t j = 0; j <= i; ++j) {
+                sums[j] = triangle[i][j] + std::min(below[j], below[j+1]);
+            }
+        }
+
+        struct Candidate {
+            int sum;
+            size_t parent;      // index into found, or SIZE_MAX for the optimal path
+            size_t row;         // row at which the parent's direction is flipped
+            bool operator<(const Candidate& other) const {
+                if (sum != other.sum) return sum < other.sum;
+                if (parent != other.parent) return parent < other.parent;
+                return row < other.row;
+            }
+        };
+
+        // Ordered set as a double-ended heap: the best candidate is taken from the front, the worst is dropped from
+        // the back once more candidates are queued than paths are still wanted
+        std::set<Candidate> candidates;
+        candidates.insert({dp[0], std::numeric_limits<size_t>::max(), 0});
+        size_t words = CompactPath::word_count(n);
+        size_t wanted = k;
+
+        while (!candidates.empty() && wanted > 0) {
+            Candidate candidate = *candidates.begin();
+            candidates.erase(candidates.begin());
+            wanted -= 1;
+
+            RankedPath path;
+            path.sum = candidate.sum;
+            path.directions.assign(words, 0);
+
+            size_t col = 0;
+            int prefix = 0;
+            size_t tail_start = 0;
+            if (candidate.parent != std::numeric_limits<size_t>::max()) {
+                const RankedPath& parent = found[candidate.parent];
+                for (size_t r = 0; r <= candidate.row; ++r) {
+                    bool right = parent.went_right(r) != (r == candidate.row);
+                    prefix += triangle[r][col];
+                    if (right) {
+                        path.directions[r / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (r % PackedChoiceBits::WORD_BITS);
+                        col += 1;
+                    }
+                }
+                tail_start = candidate.row + 1;
+            }
+
+            for (size_t r = tail_start; r + 1 < n; ++r) {
+                prefix += triangle[r][col];
+                const int* below = dp_row(r + 1);
+                bool right = below[col+1] < below[col];
+                size_t other = right ? col : col + 1;
+                Candidate deviation{prefix + below[other], found.size(), r};
+                if (candidates.size() < wanted) {
+                    candidates.insert(deviation);
+                } else if (wanted > 0 && deviation < *candidates.rbegin()) {
+                    candidates.erase(std::prev(candidates.end()));
+                    candidates.insert(deviation);
+                }
+                if (right) {
+                    path.directions[r / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (r % PackedChoiceBits::WORD_BITS);
+                    col += 1;
+                }
+            }
+
+            found.push_back(std::move(path));
+        }
+
+        logger.info("Found " + std::to_string(found.size()) + " paths, best sum: " + std::to_string(found.front().sum) +
+                    ", worst sum: " + std::to_string(found.back().sum));
+        return found;
+
+    } catch (const std::exception& error) {
+        logger.error("Error in k-best path search: " + std::string(error.what()));
+        return {};
+    }
+}
+
+// Many triangles packed back to back in one flat buffer
+class TriangleBatch {
+private:
+    std::vector<int> cells;
+    std::vector<size_t> offsets;
+    std::vector<size_t> heights;
+
+public:
+    void reserve(size_t triangle_count, size_t cell_count) {
+        offsets.reserve(triangle_count);
+        heights.reserve(triangle_count);
+        cells.reserve(cell_count);
+    }
+
+    void add(const int* triangle_cells, size_t rows) {
+        if (rows == 0) {
+            throw std::invalid_argument("Batch triangles must have at least one row");
+        }
+        offsets.push_back(cells.size());
+        heights.push_back(rows);
+        cells.insert(cells.end(), triangle_cells, triangle_cells + TriangleView::cell_count(rows));
+    }
+
+    void add(const std::vector<std::vector<int>>& triangle) {
+        if (triangle_is_empty(triangle)) {
+            throw std::invalid_argument("Batch triangles must have at least one row");
+        }
+        offsets.push_back(cells.size());
+        heights.push_back(triangle.size());
+        for (const auto& row : triangle) {
+            cells.insert(cells.end(), row.begin(), row.end());
+        }
+    }
+
+    size_t size() const {
+        return heights.size();
+    }
+
+    size_t height(size_t index) const {
+        return heights[index];
+    }
+
+    TriangleView triangle(size_t index) const {
+        return {cells.data() + offsets[index], heights[index]};
+    }
+
+    size_t max_height() const {
+        return heights.empty() ? 0 : *std::max_element(heights.begin(), heights.end());
+    }
+};
+
+// Flat outputs: one sum per triangle and path_words words of direction bits per triangle (bit i set = row i went right)
+struct BatchResults {
+    std::vector<int> sums;
+    std::vector<uint64_t> path_bits;
+    size_t path_words = 0;
+
+    size_t column(size_t index, size_t row) const {
+        size_t col = 0;
+        for (size_t i = 0; i < row; ++i) {
+            col += (path_bits[index * path_words + i / PackedChoiceBits::WORD_BITS] >> (i % PackedChoiceBits::WORD_BITS)) & 1u;
+        }
+        return col;
+    }
+
+    CompactPath path(size_t index, size_t rows) const {
+        auto first = path_bits.begin() + index * path_words;
+        return CompactPath(rows, sums[index], std::vector<uint64_t>(first, first + path_words));
+    }
+};
+
+constexpr size_t BATCH_LANES = 16;
+
+// One row of cells for BATCH_LANES interleaved triangles; choices[j] gets the lanes that took the right child.
+// sums is updated in place
+void batch_row_kernel_scalar(const int* cells, int* sums, size_t width, uint32_t* choices) {
+    for (size_t j = 0; j < width; ++j) {
+        const int* below = sums + j * BATCH_LANES;
+        const int* below_right = below + BATCH_LANES;
+        uint32_t mask = 0;
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            bool right = below_right[lane] < below[lane];
+            sums[j * BATCH_LANES + lane] = cells[j * BATCH_LANES + lane] + (right ? below_right[lane] : below[lane]);
+            mask |= static_cast<uint32_t>(right) << lane;
+        }
+        choices[j] = mask;
+    }
+}
+
+#if defined(TRIANGLE_X86_DISPATCH)
+__attribute__((target("avx2")))
+void batch_row_kernel_avx2(const int* cells, int* sums, size_t width, uint32_t* choices) {
+    for (size_t j = 0; j < width; ++j) {
+        uint32_t mask = 0;
+        for (size_t half = 0; half < BATCH_LANES; half += 8) {
+            int* below = sums + j * BATCH_LANES + half;
+            __m256i down = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below));
+            __m256i down_right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(below + BATCH_LANES));
+            __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cells + j * BATCH_LANES + half));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(below), _mm256_add_epi32(value, _mm256_min_epi32(down, down_right)));
+            mask |= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(down, down_right)))) << half;
+        }
+        choices[j] = mask;
+    }
+}
+
+__attribute__((target("avx512f")))
+void batch_row_kernel_avx512(const int* cells, int* sums, size_t width, uint32_t* choices) {
+    for (size_t j = 0; j < width; ++j) {
+        int* below = sums + j * BATCH_LANES;
+        __m512i down = _mm512_loadu_si512(below);
+        __m512i down_right = _mm512_loadu_si512(below + BATCH_LANES);
+        _mm512_storeu_si512(below, _mm512_add_epi32(_mm512_loadu_si512(cells + j * BATCH_LANES), min_epi32_avx512(down, down_right)));
+        choices[j] = _mm512_cmpgt_epi32_mask(down, down_right);
+    }
+}
+#endif
+
+using BatchRowKernelFunction = void (*)(const int*, int*, size_t, uint32_t*);
+
+BatchRowKernelFunction batch_row_kernel_for(CpuLevel level) {
+#if defined(TRIANGLE_X86_DISPATCH)
+    if (level >= CpuLevel::AVX512) return batch_row_kernel_avx512;
+    if (level >= CpuLevel::AVX2) return batch_row_kernel_avx2;
+#else
+    (void)level;
+#endif
+    return batch_row_kernel_scalar;
+}
+
+const BatchRowKernelFunction active_batch_row_kernel = batch_row_kernel_for(active_cpu_level);
+
+// Triangles of equal height are interleaved BATCH_LANES at a time so each SIMD lane solves its own instance;
+// groups are spread across the pool
+BatchResults minimum_total_batch(const TriangleBatch& batch, Logger& logger, ThreadPool& pool = ThreadPool::shared()) {
+    logger.info("Solving batch of " + std::to_string(batch.size()) + " triangles");
+    auto start = std::chrono::high_resolution_clock::now();
+
+    BatchResults results;
+    results.sums.resize(batch.size());
+    results.path_words = std::max<size_t>(1, (batch.max_height() + PackedChoiceBits::WORD_BITS - 2) / PackedChoiceBits::WORD_BITS);
+    results.path_bits.assign(batch.size() * results.path_words, 0);
+
+    std::vector<size_t> order(batch.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return batch.height(a) < batch.height(b); });
+
+    // Each group holds up to BATCH_LANES triangles of the same height
+    std::vector<std::pair<size_t, size_t>> groups;
+    for (size_t begin = 0; begin < order.size(); ) {
+        size_t end = begin + 1;
+        while (end < order.size() && end - begin < BATCH_LANES && batch.height(order[end]) == batch.height(order[begin])) {
+            ++end;
+        }
+        groups.emplace_back(begin, end);
+        begin = end;
+    }
+
+    std::atomic<size_t> next_group{0};
+    pool.run([&](size_t) {
+        std::vector<int> cells;
+        std::vector<int> sums;
+        std::vector<uint32_t> lane_choices;
+
+        for (size_t g = next_group.fetch_add(1); g < groups.size(); g = next_group.fetch_add(1)) {
+            auto [begin, end] = groups[g];
+            size_t lanes = end - begin;
+            size_t rows = batch.height(order[begin]);
+            size_t cell_count = TriangleView::cell_count(rows);
+
+            cells.assign(cell_count * BATCH_LANES, 0);
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                TriangleView triangle = batch.triangle(order[begin + lane]);
+                for (size_t c = 0; c < cell_count; ++c) {
+                    cells[c * BATCH_LANES + lane] = triangle.cells[c];
+                }
+            }
+
+            sums.assign(cells.begin() + TriangleView::row_offset(rows - 1) * BATCH_LANES, cells.end());
+            lane_choices.resize(TriangleView::cell_count(rows - 1));
+            for (size_t i = rows - 1; i-- > 0; ) {
+                size_t offset = TriangleView::row_offset(i);
+                active_batch_row_kernel(&cells[offset * BATCH_LANES], sums.data(), i + 1, &lane_choices[offset]);
+            }
+
+            for (size_t lane = 0; lane < lanes; ++lane) {
+                size_t index = order[begin + lane];
+                results.sums[index] = sums[lane];
+
+                uint64_t* path = &results.path_bits[index * results.path_words];
+                size_t col = 0;
+                for (size_t i = 0; i + 1 < rows; ++i) {
+                    if ((lane_choices[TriangleView::row_offset(i) + col] >> lane) & 1u) {
+                        col += 1;
+                        path[i / PackedChoiceBits::WORD_BITS] |= uint64_t{1} << (i % PackedChoiceBits::WORD_BITS);
+                    }
+                }
+            }
+        }
+    });
+
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    logger.info("Batch complete: " + std::to_string(groups.size()) + " lane groups, " + std::to_string(seconds) +
+                "s, " + std::to_string(seconds > 0 ? batch.size() / seconds : 0.0) + " triangles/s");
+    return results;
+}
+
+using SolverFunction = std::function<std::pair<int, std::vector<int>>(const std::vector<std::vector<int>>&, Logger&)>;
+
+struct SolverVariant {
+    std::string name;
+    SolverFunction solve;
+    double bytes_per_cell = 0.125;    // working memory on top of the input; most variants keep one choice bit per cell
+};
+
+std::vector<SolverVariant> get_solver_variants() {
+    return {
+        {"compact", minimum_total_compact<std::vector<std::vector<int>>>},
+        {"parallel", [](const std::vector<std::vector<int>>& triangle, Logger& logger) {
+            return minimum_total_parallel(triangle, logger);
+        }},
+        {"tiled", [](const std::vector<std::vector<int>>& triangle, Logger& logger) {
+            return minimum_total_tiled(triangle, logger);
+        }},
+        {"auto", [](const std::vector<std::vector<int>>& triangle, Logger& logger) {
+            auto [min_sum, path] = minimum_total_auto(triangle, logger);
+            return std::make_pair(static_cast<int>(min_sum), path);
+        }, 0.125},    // choice bits; the narrowed row buffers are O(rows)
+        {"checkpointed", [](const std::vector<std::vector<int>>& triangle, Logger& logger) {
+            return minimum_total_checkpointed(triangle, logger);
+        }, 0.0},
+        {"streaming", [](const std::vector<std::vector<int>>& triangle, Logger& logger) {
+            size_t next = 0;
+            auto [min_sum, columns] = minimum_total_stream([&](std::vector<int>& row) {
+                if (next == triangle.size()) return false;
+                row = triangle[next++];
+                return true;
+            }, logger);
+
+            std::vector<int> path;
+            for (size_t i = 0; i < columns.size(); ++i) {
+                path.push_back(triangle[i][columns[i]]);
+            }
+            return std::make_pair(min_sum, path);
+        }}
+    };
+}
+
+class TriangleGenerator {
+private:
+    std::random_device rd;
+    std::mt19937 gen;
+    
+public:
+    TriangleGenerator() : gen(rd()) {}
+    
+    std::vector<std::vector<int>> generate_random_triangle(int rows, int min_val = -10, int max_val = 10) {
+        Logger logger(false);
+        logger.info(LogMessages::GENERATION_START + std::to_string(rows) + " with " + std::to_string(rows) + " rows");
+        
+        std::vector<std::vector<int>> triangle;
+        std::uniform_int_distribution<int> dis(min_val, max_val);
+        
+        for (int i = 0; i < rows; ++i) {
+            std::vector<int> row;
+            for (int j = 0; j <= i; ++j) {
+                row.push_back(dis(gen));
+            }
+            triangle.push_back(row);
+        }
+        
+        logger.info(LogMessages::GENERATION_COMPLETE + std::string(format_triangle(triangle)));
+        return triangle;
+    }
+};
+
+// Triangle in one flat buffer, row i starting at i * (i + 1) / 2
+struct FlatTriangle {
+    std::vector<int> cells;
+    size_t rows = 0;
+
+    TriangleView view() const {
+        return {cells.data(), rows};
+    }
+
+    std::vector<std::vector<int>> to_nested() const {
+        std::vector<std::vector<int>> triangle(rows);
+        for (size_t i = 0; i < rows; ++i) {
+            const int* row = view()[i];
+            triangle[i].assign(row, row + i + 1);
+        }
+        return triangle;
+    }
+};
+
+enum class ValueDistribution {
+    Uniform,
+    Skewed,        // cubic skew towards min_val
+    Adversarial    // min_val or max_val at random, so every left/right comparison is a coin flip
+};
+
+// Counter-based generator: cell k is a pure function of (seed, k), so the output does not depend on how the
+// cells are split between threads
+class SeededTriangleGenerator {
+private:
+    uint64_t seed;
+
+    static uint64_t mix(uint64_t x) {
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        return x ^ (x >> 31);
+    }
+
+    static int scale(uint64_t bits, int min_val, int max_val) {
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(max_val) - min_val) + 1;
+        return static_cast<int>(min_val + static_cast<int64_t>((static_cast<unsigned __int128>(bits) * range) >> 64));
+    }
+
+public:
+    explicit SeededTriangleGenerator(uint64_t generator_seed) : seed(generator_seed) {}
+
+    int cell(uint64_t index, int min_val, int max_val, ValueDistribution distribution) const {
+        uint64_t bits = mix(seed ^ mix(index));
+        switch (distribution) {
+            case ValueDistribution::Skewed: {
+                double u = (bits >> 11) * (1.0 / 9007199254740992.0);
+                double skewed = u * u * u;
+                return min_val + static_cast<int>(skewed * (static_cast<double>(max_val) - min_val + 1));
+            }
+            case ValueDistribution::Adversarial:
+                return (bits >> 63) ? max_val : min_val;
+            default:
+                return scale(bits, min_val, max_val);
+        }
+    }
+
+    FlatTriangle generate(size_t rows, int min_val = -10, int max_val = 10,
+                          ValueDistribution distribution = ValueDistribution::Uniform,
+                          ThreadPool& pool = ThreadPool::shared()) const {
+        if (min_val > max_val) {
+            throw std::invalid_argument("min_val must not exceed max_val");
+        }
+
+        FlatTriangle triangle;
+        triangle.rows = rows;
+        triangle.cells.resize(TriangleView::cell_count(rows));
+
+        size_t total = triangle.cells.size();
+        size_t chunks = pool.size();
+        pool.run([&](size_t worker) {
+            size_t begin = total * worker / chunks;
+            size_t end = total * (worker + 1) / chunks;
+            for (size_t k = begin; k < end; ++k) {
+                triangle.cells[k] = cell(k, min_val, max_val, distribution);
+            }
+        });
+        return triangle;
+    }
+
+    // Writes a generated triangle as a binary container for later runs
+    void save_dataset(const std::string& filename, size_t rows, Logger& logger, int min_val = -10, int max_val = 10,
+                      ValueDistribution distribution = ValueDistribution::Uniform) const {
+        FlatTriangle triangle = generate(rows, min_val, max_val, distribution);
+        TriangleFileReader(logger).write_binary(filename, triangle.view());
+    }
+};
+
+struct TestCase {
+    std::string name;
+    std::vector<std::vector<int>> triangle;
+    int expected_sum;
+    std::vector<int> expected_path;
+};
+
+template <size_t Rows>
+struct FixedTestCase {
+    const char* name;
+    FixedTriangle<Rows> triangle;
+    int expected_sum;
+    std::array<int, Rows> expected_path;
+};
+
+template <size_t Rows>
+constexpr bool fixture_holds(const FixedTestCase<Rows>& test_case) {
+    FixedPathResult<Rows> result = minimum_total_fixed(test_case.triangle);
+    if (result.sum != test_case.expected_sum) return false;
+    for (size_t row = 0; row < Rows; ++row) {
+        if (result.path[row] != test_case.expected_path[row]) return false;
+    }
+    return true;
+}
+
+template <size_t Rows>
+TestCase to_test_case(const FixedTestCase<Rows>& test_case) {
+    return {test_case.name, test_case.triangle.to_nested(), test_case.expected_sum,
+            std::vector<int>(test_case.expected_path.begin(), test_case.expected_path.end())};
+}
+
+class TriangleTests {
+public:
+    static constexpr FixedTestCase<4> BASIC_1{"Basic Triangle 1", {{2, 3, 4, 6, 5, 7, 4, 1, 8, 3}}, 11, {2, 3, 5, 1}};
+    static constexpr FixedTestCase<4> BASIC_2{"Basic Triangle 2", {{-1, 2, 3, 1, -1, -3, 4, 2, 1, 3}}, 0, {-1, 3, -3, 1}};
+
+    static constexpr FixedTestCase<1> SINGLE_ELEMENT{"Single Element", {{5}}, 5, {5}};
+    static constexpr FixedTestCase<2> TWO_ROWS{"Two Rows", {{1, 2, 3}}, 3, {1, 2}};
+    static constexpr FixedTestCase<3> ALL_SAME{"All Same Values", {{1, 1, 1, 1, 1, 1}}, 3, {1, 1, 1}};
+    static constexpr FixedTestCase<3> NEGATIVE{"Negative Values", {{-1, -2, -3, -4, -5, -6}}, -10, {-1, -3, -6}};
+
+    static constexpr FixedTestCase<5> FIVE_ROWS{"5x5 Triangle", {{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}},
+                                                1 + 2 + 4 + 7 + 11, {1, 2, 4, 7, 11}};
+
+    static std::vector<TestCase> get_basic_tests() {
+        return {to_test_case(BASIC_1), to_test_case(BASIC_2)};
+    }
+    
+    static std::vector<TestCase> get_edge_tests() {
+        return {to_test_case(SINGLE_ELEMENT), to_test_case(TWO_ROWS), to_test_case(ALL_SAME), to_test_case(NEGATIVE)};
+    }
+    
+    static std::vector<TestCase> get_large_tests() {
+        return {to_test_case(FIVE_ROWS)};
+    }
+};
+
+// The fixtures are solved by the compiler: a wrong expectation fails the build. The runtime suite still feeds them
+// to minimum_total and every solver variant
+static_assert(fixture_holds(TriangleTests::BASIC_1), "Basic Triangle 1");
+static_assert(fixture_holds(TriangleTests::BASIC_2), "Basic Triangle 2");
+static_assert(fixture_holds(TriangleTests::SINGLE_ELEMENT), "Single Element");
+static_assert(fixture_holds(TriangleTests::TWO_ROWS), "Two Rows");
+static_assert(fixture_holds(TriangleTests::ALL_SAME), "All Same Values");
+static_assert(fixture_holds(TriangleTests::NEGATIVE), "Negative Values");
+static_assert(fixture_holds(TriangleTests::FIVE_ROWS), "5x5 Triangle");
+static_assert(minimum_total_fixed(TriangleTests::BASIC_1.triangle).columns[3] == 1, "Path columns of Basic Triangle 1");
+
+struct TestResult {
+    std::string name;
+    bool passed;
+    int actual_sum;
+    std::vector<int> actual_path;
+};
+
+TestResult run_test(const TestCase& test_case, int test_number, Logger& logger) {
+    logger.info(LogMessages::TEST_START + std::to_string(test_number));
+    
+    auto [actual_sum, actual_path] = minimum_total(test_case.triangle, logger);
+    
+    bool sum_correct = (actual_sum == test_case.expected_sum);
+    bool path_correct = (actual_path == test_case.expected_path);
+    bool variants_correct = true;
+    for (const auto& variant : get_solver_variants()) {
+        auto [variant_sum, variant_path] = variant.solve(test_case.triangle, logger);
+        if (variant_sum != actual_sum || variant_path != actual_path) {
+            logger.error("Solver variant " + variant.name + " mismatch: sum = " + std::to_string(variant_sum) +
+                         ", path = " + std::string(format_path(variant_path)));
+            variants_correct = false;
+        }
+    }
+    bool passed = sum_correct && path_correct && variants_correct;
+    
+    if (passed) {
+        logger.info(LogMessages::TEST_PASSED);
+    } else {
+        logger.info(LogMessages::TEST_FAILED);
+    }
+    
+    std::string result_msg = LogMessages::TEST_RESULT + 
+        std::to_string(test_number) + ": Expected sum = " + std::to_string(test_case.expected_sum) +
+        ", Got = " + std::to_string(actual_sum) + " | Expected path = " + 
+        std::string(format_path(test_case.expected_path)) + ", Got = " + std::string(format_path(actual_path));
+    logger.info(result_msg);
+    
+    return {test_case.name, passed, actual_sum, actual_path};
+}
+
+bool check_row_kernel(const std::string& name, RowKernelFunction kernel, Logger& logger) {
+    std::mt19937 gen(12345);
+    std::uniform_int_distribution<int> dis(-100, 100);
+
+    for (size_t width = 1; width <= 200; ++width) {
+        std::vector<int> row(width);
+        std::vector<int> sums(width + 1);
+        for (auto& value : row) value = dis(gen);
+        for (auto& value : sums) value = dis(gen) % 4;  // many ties
+
+        std::vector<int> expected_sums = sums;
+        std::vector<int> actual_sums = sums;
+        size_t word_count = (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS;
+        std::vector<uint64_t> expected_bits(word_count, ~uint64_t{0});
+        std::vector<uint64_t> actual_bits(word_count, ~uint64_t{0});
+
+        std::vector<int> separate_out(width);
+
+        // The OR starts from an earlier row's, so bits already set must survive
+        SumBits expected_seen;
+        expected_seen.add(1 << (width % 31));
+        SumBits actual_seen = expected_seen;
+
+        // The leftmost minimum must match a rescan of the row, ties included
+        RowMinimum actual_minimum;
+        row_kernel_scalar(row.data(), expected_sums.data(), expected_sums.data(), width, expected_bits.data(),
+                          &expected_seen);
+        kernel(row.data(), sums.data(), separate_out.data(), width, nullptr, nullptr, &actual_minimum);
+        kernel(row.data(), actual_sums.data(), actual_sums.data(), width, actual_bits.data(), &actual_seen, nullptr);
+
+        auto expected_min = std::min_element(expected_sums.begin(), expected_sums.begin() + width);
+        bool sums_match = std::equal(expected_sums.begin(), expected_sums.begin() + width, actual_sums.begin()) &&
+                          std::equal(separate_out.begin(), separate_out.end(), expected_sums.begin());
+        bool minimum_match = actual_minimum.leftmost() ==
+                             std::make_pair(*expected_min, static_cast<size_t>(expected_min - expected_sums.begin()));
+        if (!sums_match || !minimum_match || expected_seen.bits() != actual_seen.bits() || expected_bits != actual_bits) {
+            logger.error("Row kernel " + name + " mismatch at width " + std::to_string(width));
+            return false;
+        }
+    }
+    return true;
+}
+
+#if defined(TRIANGLE_X86_DISPATCH)
+// Narrow-lane kernel against the scalar loop, so ties and both signs are common. Sums start inside the offset
+// range; every fifth width of int cells also holds values far outside Sum, which saturate and must be flagged
+template <typename Cell, typename Sum>
+bool check_narrow_row_kernel(const std::string& name,
+                             void (*kernel)(const Cell*, const Sum*, Sum*, size_t, uint64_t*, bool*), Logger& logger) {
+    std::mt19937 gen(12346);
+    std::uniform_int_distribution<int> dis(-20, 20);
+    std::uniform_int_distribution<int> any(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+
+    for (size_t width = 1; width <= 200; ++width) {
+        std::vector<Cell> row(width);
+        std::vector<Sum> below(width + 1);
+        for (auto& value : row) value = static_cast<Cell>(dis(gen));
+        for (auto& value : below) value = static_cast<Sum>(OffsetSums<Sum>::OFFSET + dis(gen) % 4);
+        if (std::is_same_v<Cell, int> && width % 5 == 0) row[gen() % width] = static_cast<Cell>(any(gen));
+
+        std::vector<Sum> expected_sums(width);
+        std::vector<Sum> actual_sums(width);
+        size_t word_count = (width + PackedChoiceBits::WORD_BITS - 1) / PackedChoiceBits::WORD_BITS;
+        std::vector<uint64_t> expected_bits(word_count, 0);
+        std::vector<uint64_t> actual_bits(word_count, ~uint64_t{0});
+        bool expected_left = false;
+        bool actual_left = false;
+
+        row_kernel_narrow_tail(row.data(), below.data(), expected_sums.data(), 0, width, expected_bits.data(),
+                               &expected_left);
+        kernel(row.data(), below.data(), actual_sums.data(), width, actual_bits.data(), &actual_left);
+
+        if (expected_sums != actual_sums || expected_bits != actual_bits || expected_left != actual_left) {
+            logger.error("Row kernel " + name + " mismatch at width " + std::to_string(width));
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Sum>
+bool check_narrow_row_kernels(const std::string& name, void (*narrow)(const Sum*, const Sum*, Sum*, size_t, uint64_t*, bool*),
+                              void (*fused)(const int*, const Sum*, Sum*, size_t, uint64_t*, bool*), Logger& logger) {
+    return check_narrow_row_kernel(name, narrow, logger) && check_narrow_row_kernel(name + " from int", fused, logger);
+}
+#endif
+
+TestResult run_row_kernel_tests(Logger& logger) {
+    logger.info("Verifying SIMD row kernels against scalar kernel");
+    bool passed = true;
+    CpuLevel detected = detect_cpu_level();
+    for (CpuLevel level : {CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512}) {
+        if (level <= detected) {
+            passed = check_row_kernel(cpu_level_name(level), row_kernel_for(level), logger) && passed;
+        }
+    }
+
+#if defined(TRIANGLE_X86_DISPATCH)
+    for (CpuLevel level : {CpuLevel::SSE42, CpuLevel::AVX2, CpuLevel::AVX512}) {
+        if (level > detected) continue;
+        std::string name = cpu_level_name(level);
+        switch (level) {
+            case CpuLevel::SSE42:
+                passed = check_narrow_row_kernels<int8_t>(name + " int8", row_kernel_int8_sse42, row_kernel_int8_sse42, logger) &&
+                         check_narrow_row_kernels<int16_t>(name + " int16", row_kernel_int16_sse42, row_kernel_int16_sse42, logger) &&
+                         passed;
+                break;
+            case CpuLevel::AVX2:
+                passed = check_narrow_row_kernels<int8_t>(name + " int8", row_kernel_int8_avx2, row_kernel_int8_avx2, logger) &&
+                         check_narrow_row_kernels<int16_t>(name + " int16", row_kernel_int16_avx2, row_kernel_int16_avx2, logger) &&
+                         passed;
+                break;
+            default:
+                passed = check_narrow_row_kernels<int8_t>(name + " int8", row_kernel_int8_avx512, row_kernel_int8_avx512, logger) &&
+                         check_narrow_row_kernels<int16_t>(name + " int16", row_kernel_int16_avx512, row_kernel_int16_avx512, logger) &&
+                         passed;
+                break;
+        }
+    }
+#endif
+    logger.info(std::string("Detected CPU level: ") + cpu_level_name(detected) + ", active row kernel: " + row_kernel_name());
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Row Kernel " + row_kernel_name(), passed, 0, {}};
+}
+
+std::vector<std::vector<int>> make_seeded_triangle(size_t rows, unsigned seed, int min_val = -100, int max_val = 100) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(min_val, max_val);
+    std::vector<std::vector<int>> triangle(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        triangle[i].resize(i + 1);
+        for (auto& value : triangle[i]) value = dis(gen);
+    }
+    return triangle;
+}
+
+// Test file under the temp directory, unique per process and per instance so
+// concurrent test runs never share a path; removed on scope exit
+class ScratchFile {
+    std::string file_path;
+
+public:
+    ScratchFile(const std::string& stem, const std::string& extension) {
+        static std::atomic<unsigned> counter{0};
+        std::string name = stem + "_" + std::to_string(::getpid()) + "_" + std::to_string(counter++) + extension;
+        file_path = (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    ~ScratchFile() {
+        std::error_code ignored;
+        std::filesystem::remove(file_path, ignored);
+    }
+
+    ScratchFile(const ScratchFile&) = delete;
+    ScratchFile& operator=(const ScratchFile&) = delete;
+
+    const std::string& path() const { return file_path; }
+};
+
+TestResult run_parallel_solver_test(Logger& logger) {
+    logger.info("Verifying parallel solver on a wide triangle with small column blocks");
+
+    auto triangle = make_seeded_triangle(1500, 2024);
+
+    ThreadPool pool(4);
+    ParallelOptions options;
+    options.block_columns = 64;
+    options.min_parallel_width = 256;
+
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    bool passed = true;
+    int actual_sum = 0;
+    for (size_t band_rows : {1, 7, 64, 5000}) {
+        options.band_rows = band_rows;
+        auto result = minimum_total_parallel(triangle, logger, pool, options);
+        actual_sum = result.first;
+        passed = passed && result.first == expected_sum && result.second == expected_path;
+    }
+
+    // An error inside a worker reaches the solver's error path instead of terminating the process
+    auto ragged = triangle;
+    ragged[1200].pop_back();
+    passed = passed && minimum_total_parallel(ragged, logger, pool, options).first == std::numeric_limits<int>::max();
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Parallel Solver", passed, actual_sum, {}};
+}
+
+TestResult run_tiled_solver_test(Logger& logger) {
+    logger.info("Verifying tiled solver on a wide triangle with small tiles");
+
+    auto triangle = make_seeded_triangle(1500, 2025);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    bool passed = true;
+    int actual_sum = 0;
+    for (size_t tile_columns : {1, 37, 64, 100}) {
+        for (size_t tile_rows : {1, 7, 64}) {
+            TilingOptions options;
+            options.tile_columns = tile_columns;
+            options.tile_rows = tile_rows;
+
+            auto result = minimum_total_tiled(triangle, logger, options);
+            actual_sum = result.first;
+            passed = passed && result.first == expected_sum && result.second == expected_path;
+        }
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Tiled Solver", passed, actual_sum, {}};
+}
+
+TestResult run_checkpointed_solver_test(Logger& logger) {
+    logger.info("Verifying checkpointed reconstruction for several checkpoint intervals");
+
+    auto triangle = make_seeded_triangle(500, 2027, -3, 3);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    bool passed = true;
+    for (size_t interval : {0, 1, 2, 7, 22, 499, 1000}) {
+        auto result = minimum_total_checkpointed(triangle, logger, interval);
+        passed = passed && result.first == expected_sum && result.second == expected_path;
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Checkpointed Solver", passed, expected_sum, {}};
+}
+
+template <typename Cell, typename Sum>
+bool check_typed_solver(const std::vector<std::vector<int>>& triangle, int expected_sum,
+                        const std::vector<int>& expected_path, Logger& logger) {
+    std::vector<Cell> cells;
+    for (const auto& row : triangle) {
+        for (int value : row) cells.push_back(static_cast<Cell>(value));
+    }
+    auto [actual_sum, actual_path] = minimum_total_typed<Cell, Sum>(BasicTriangleView<Cell>{cells.data(), triangle.size()}, logger);
+    return actual_sum == static_cast<Sum>(expected_sum) && std::equal(actual_path.begin(), actual_path.end(),
+                                                                      expected_path.begin(), expected_path.end());
+}
+
+TestResult run_value_type_test(Logger& logger) {
+    logger.info("Verifying typed solvers and value type selection");
+
+    auto triangle = make_seeded_triangle(200, 2029, -10, 10);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    bool passed = check_typed_solver<int8_t, int32_t>(triangle, expected_sum, expected_path, logger) &&
+                  check_typed_solver<int16_t, int16_t>(triangle, expected_sum, expected_path, logger) &&
+                  check_typed_solver<int32_t, int64_t>(triangle, expected_sum, expected_path, logger) &&
+                  check_typed_solver<int64_t, int64_t>(triangle, expected_sum, expected_path, logger) &&
+                  check_typed_solver<float, double>(triangle, expected_sum, expected_path, logger) &&
+                  check_typed_solver<double, double>(triangle, expected_sum, expected_path, logger);
+
+    passed = passed && select_value_type(-10, 10, 5) == ValueType::Int8 &&
+             select_value_type(-10, 10, 200) == ValueType::Int16 &&
+             select_value_type(0, 100000, 10000) == ValueType::Int32 &&
+             select_value_type(-100000, 100000, 100000) == ValueType::Int64;
+
+    // 3 * 10^9 does not fit in int
+    std::vector<std::vector<int>> large_values = {{1000000000}, {1000000000, 1000000000}, {1000000000, 1000000000, 1000000000}};
+    passed = passed && minimum_total_auto(large_values, logger).first == 3000000000LL;
+
+    // Small values at the bottom start in int8 lanes and widen through int16 and int32 as the sums grow
+    auto widening = make_seeded_triangle(400, 2031, -3, 3);
+    for (size_t i = 0; i < 100; ++i) {
+        for (auto& value : widening[i]) value *= 1000;
+    }
+    auto [widening_sum, widening_path] = minimum_total_compact(widening, logger);
+    auto widened = minimum_total_auto(widening, logger);
+    passed = passed && widened.first == widening_sum && widened.second == widening_path;
+
+    // A short row is reported instead of read past
+    std::vector<std::vector<int>> short_row = {{1}, {2, 3}, {4, 5}};
+    passed = passed && minimum_total_auto(short_row, logger).first == std::numeric_limits<int64_t>::max();
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Value Types", passed, expected_sum, {}};
+}
+
+TestResult run_batch_solver_test(Logger& logger) {
+    logger.info("Verifying batched solver against the streaming solver");
+
+    std::mt19937 gen(2030);
+    std::uniform_int_distribution<int> height_dis(1, 50);
+    TriangleBatch batch;
+    for (int t = 0; t < 500; ++t) {
+        batch.add(make_seeded_triangle(height_dis(gen), 3000 + t, -3, 3));
+    }
+
+    ThreadPool pool(3);
+    BatchResults results = minimum_total_batch(batch, logger, pool);
+
+    bool passed = true;
+    for (size_t t = 0; t < batch.size(); ++t) {
+        TriangleView triangle = batch.triangle(t);
+        StreamingTriangleSolver reference(true);
+        for (size_t i = 0; i < triangle.size(); ++i) {
+            reference.push_row(triangle[i], i + 1);
+        }
+
+        std::vector<size_t> columns = reference.path_columns();
+        passed = passed && results.sums[t] == reference.minimum_sum();
+        for (size_t i = 0; i < columns.size(); ++i) {
+            passed = passed && results.column(t, i) == columns[i];
+        }
+        passed = passed && results.path(t, triangle.size()).columns() == columns;
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Batch Solver", passed, 0, {}};
+}
+
+TestResult run_incremental_solver_test(Logger& logger) {
+    logger.info("Verifying incremental solver after point updates");
+
+    auto triangle = make_seeded_triangle(300, 2031, -5, 5);
+    IncrementalTriangleSolver solver(triangle);
+
+    std::mt19937 gen(2031);
+    std::uniform_int_distribution<int> value_dis(-5, 5);
+    bool passed = true;
+    size_t recomputed = 0;
+
+    for (int round = 0; round < 20; ++round) {
+        std::vector<CellUpdate> updates(1 + round % 4);
+        for (auto& cell : updates) {
+            cell.row = std::uniform_int_distribution<size_t>(0, triangle.size() - 1)(gen);
+            cell.col = std::uniform_int_distribution<size_t>(0, cell.row)(gen);
+            cell.value = value_dis(gen);
+            triangle[cell.row][cell.col] = cell.value;
+        }
+
+        auto [actual_sum, actual_path] = solver.update(updates);
+        auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+        passed = passed && actual_sum == expected_sum && actual_path == expected_path;
+        recomputed += solver.last_recomputed_cells();
+    }
+
+    logger.info("Incremental updates recomputed " + std::to_string(recomputed) + " cells over 20 rounds");
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Incremental Solver", passed, solver.minimum_sum(), {}};
+}
+
+TestResult run_online_solver_test(Logger& logger) {
+    logger.info("Verifying online solver while the triangle grows");
+
+    auto triangle = make_seeded_triangle(120, 2032, -4, 4);
+    OnlineTriangleSolver solver;
+    std::vector<std::vector<int>> prefix;
+    bool passed = true;
+
+    for (const auto& row : triangle) {
+        int minimum = solver.append_row(row);
+        prefix.push_back(row);
+        if (prefix.size() % 10 == 0) {
+            auto [expected_sum, expected_path] = minimum_total_compact(prefix, logger);
+            passed = passed && minimum == expected_sum && solver.path() == expected_path;
+        }
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Online Solver", passed, solver.minimum_sum(), {}};
+}
+
+TestResult run_k_best_paths_test(Logger& logger) {
+    logger.info("Verifying k-best paths against exhaustive enumeration");
+
+    auto triangle = make_seeded_triangle(12, 2033, -5, 5);
+    size_t n = triangle.size();
+
+    std::vector<int> all_sums;
+    for (uint64_t mask = 0; mask < (uint64_t{1} << (n - 1)); ++mask) {
+        int sum = triangle[0][0];
+        size_t col = 0;
+        for (size_t r = 0; r + 1 < n; ++r) {
+            col += (mask >> r) & 1u;
+            sum += triangle[r + 1][col];
+        }
+        all_sums.push_back(sum);
+    }
+    std::sort(all_sums.begin(), all_sums.end());
+
+    auto paths = k_best_paths(triangle, 100, logger);
+    bool passed = paths.size() == 100 && paths.front().sum == minimum_total_compact(triangle, logger).first;
+
+    std::vector<std::vector<uint64_t>> seen;
+    for (size_t i = 0; i < paths.size() && passed; ++i) {
+        int sum = 0;
+        for (size_t r = 0; r < n; ++r) {
+            sum += triangle[r][paths[i].column(r)];
+        }
+        passed = sum == paths[i].sum && sum == all_sums[i] && paths[i].compact(n).values(triangle).size() == n;
+        seen.push_back(paths[i].directions);
+    }
+    std::sort(seen.begin(), seen.end());
+    passed = passed && std::unique(seen.begin(), seen.end()) == seen.end();
+    passed = passed && k_best_paths(triangle, all_sums.size() + 10, logger).size() == all_sums.size();
+
+    // The capped candidate set must not change which paths a smaller k returns
+    auto first_paths = k_best_paths(triangle, 7, logger);
+    passed = passed && first_paths.size() == 7;
+    for (size_t i = 0; i < first_paths.size() && passed; ++i) {
+        passed = first_paths[i].sum == paths[i].sum && first_paths[i].directions == paths[i].directions;
+    }
+
+    int big = 1000000000;
+    passed = passed && k_best_paths({{big}, {big, big}, {big, big, big}}, 2, logger).empty();
+    passed = passed && k_best_paths({{1}, {2}}, 2, logger).empty();
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"K-Best Paths", passed, paths.empty() ? 0 : paths.front().sum, {}};
+}
+
+template <typename Moves, typename Layout>
+int64_t brute_force_min_path(const Layout& layout, const int* cells, size_t row, long long col) {
+    int64_t value = cells[layout.offset(row) + (col - layout.first(row))];
+    if (row + 1 == layout.rows) return value;
+
+    int64_t best = std::numeric_limits<int64_t>::max();
+    long long next_first = layout.first(row + 1);
+    for (int delta : Moves::deltas) {
+        long long target = col + delta;
+        if (target >= next_first && target < next_first + static_cast<long long>(layout.width(row + 1))) {
+            int64_t sub = brute_force_min_path<Moves>(layout, cells, row + 1, target);
+            if (sub != std::numeric_limits<int64_t>::max()) best = std::min(best, sub);
+        }
+    }
+    return best == std::numeric_limits<int64_t>::max() ? best : value + best;
+}
+
+template <typename Moves, typename Layout>
+bool check_move_policy(const Layout& layout, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dis(-9, 9);
+    std::vector<int> cells(layout.offset(layout.rows - 1) + layout.width(layout.rows - 1));
+    for (auto& value : cells) value = dis(gen);
+
+    GridPathResult result = min_path_dp<Moves>(layout, cells.data());
+
+    int64_t expected = std::numeric_limits<int64_t>::max();
+    for (size_t k = 0; k < layout.width(0); ++k) {
+        expected = std::min(expected, brute_force_min_path<Moves>(layout, cells.data(), 0, layout.first(0) + k));
+    }
+
+    int64_t path_sum = 0;
+    for (size_t r = 0; r < layout.rows; ++r) {
+        path_sum += cells[layout.offset(r) + (result.columns[r] - layout.first(r))];
+    }
+    return result.sum == expected && path_sum == expected;
+}
+
+TestResult run_move_policy_test(Logger& logger) {
+    logger.info("Verifying move-policy engine on triangle, grid, pyramid and band layouts");
+
+    // minimum_total is the engine's triangle instantiation; quiet, since it traces every cell
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    auto triangle = make_seeded_triangle(300, 2034);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+    auto [actual_sum, actual_path] = minimum_total(triangle, quiet);
+
+    bool passed = actual_sum == expected_sum && actual_path == expected_path &&
+                  check_move_policy<DownMoves>(TriangleLayout{10}, 1) &&
+                  check_move_policy<ThreeWayMoves>(GridLayout{7, 5}, 2) &&
+                  check_move_policy<DownMoves>(GridLayout{8, 4}, 3) &&
+                  check_move_policy<PyramidMoves>(PyramidLayout{6}, 4) &&
+                  check_move_policy<ThreeWayMoves>(BandLayout(8, 6, 1), 5) &&
+                  check_move_policy<ThreeWayMoves>(BandLayout(7, 10, 2), 6);
+
+    // Large values run on 64-bit sums; a result outside int is reported instead of wrapping
+    const int big = 1000000000;
+    passed = passed && minimum_total({{big}, {-big, 5}}, quiet) == std::make_pair(0, std::vector<int>{big, -big});
+    passed = passed && minimum_total({{big}, {big, big}, {big, big, big}}, quiet).first == std::numeric_limits<int>::max();
+
+    // Sums that pass +-2^29 partway up the int kernel rows, or start beyond it, are redone in 64 bits
+    std::vector<std::vector<int>> climbing;
+    for (size_t r = 0; r < 300; ++r) climbing.emplace_back(r + 1, 2000000);
+    const int lowest = std::numeric_limits<int>::min();
+    passed = passed && minimum_total(climbing, quiet).first == 600000000;
+    passed = passed && minimum_total({{0}, {lowest, 5}}, quiet) == std::make_pair(lowest, std::vector<int>{0, lowest});
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Move Policy Engine", passed, actual_sum, {}};
+}
+
+TestResult run_semiring_test(Logger& logger) {
+    logger.info("Verifying semiring kernels and the fused pass");
+
+    auto triangle = make_seeded_triangle(200, 2035, -3, 3);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    auto negated = triangle;
+    for (auto& row : negated) {
+        for (auto& value : row) value = -value;
+    }
+
+    auto [min_sum, max_sum, path_count, optimal] =
+        triangle_semiring_fused<MinPlusSemiring, MaxPlusSemiring, CountingSemiring<>, MinPlusCountSemiring<>>(triangle);
+
+    uint64_t all_paths = 1;
+    for (size_t i = 1; i < triangle.size(); ++i) all_paths = all_paths * 2 % 1000000007;
+
+    std::vector<std::vector<int>> flat = {{1}, {1, 1}, {1, 1, 1}, {1, 1, 1, 1}};
+    auto flat_optimal = triangle_semiring<MinPlusCountSemiring<>>(flat);
+
+    bool passed = min_sum == expected_sum && min_sum == triangle_semiring<MinPlusSemiring>(triangle) &&
+                  max_sum == -triangle_semiring<MinPlusSemiring>(negated) &&
+                  path_count == all_paths && optimal.sum == expected_sum && optimal.count >= 1 &&
+                  optimal == triangle_semiring<MinPlusCountSemiring<>>(triangle) &&
+                  flat_optimal.sum == 4 && flat_optimal.count == 8;
+
+    logger.info("Min: " + std::to_string(min_sum) + ", max: " + std::to_string(max_sum) +
+                ", optimal paths: " + std::to_string(optimal.count));
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Semiring Kernels", passed, static_cast<int>(min_sum), {}};
+}
+
+TestResult run_seeded_generator_test(Logger& logger) {
+    logger.info("Verifying seeded generator determinism across thread counts");
+
+    SeededTriangleGenerator generator(42);
+    ThreadPool single(1);
+    ThreadPool several(4);
+
+    bool passed = true;
+    for (auto distribution : {ValueDistribution::Uniform, ValueDistribution::Skewed, ValueDistribution::Adversarial}) {
+        FlatTriangle a = generator.generate(500, -50, 50, distribution, single);
+        FlatTriangle b = generator.generate(500, -50, 50, distribution, several);
+        passed = passed && a.cells == b.cells;
+        for (int value : a.cells) {
+            passed = passed && value >= -50 && value <= 50;
+        }
+    }
+    passed = passed && generator.generate(100).cells != SeededTriangleGenerator(43).generate(100).cells;
+
+    FlatTriangle full_range = generator.generate(100, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    passed = passed && full_range.cells.size() == TriangleView::cell_count(100);
+
+    ScratchFile dataset_file("triangle_dataset_test", ".bin");
+    const std::string& dataset = dataset_file.path();
+    generator.save_dataset(dataset, 200, logger);
+    {
+        MappedTriangle mapped(dataset);
+        FlatTriangle expected = generator.generate(200);
+        passed = passed && std::equal(expected.cells.begin(), expected.cells.end(), mapped.view().cells);
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Seeded Generator", passed, 0, {}};
+}
+
+TestResult run_file_format_test(Logger& logger) {
+    logger.info("Verifying text and binary triangle files");
+
+    auto triangle = make_seeded_triangle(300, 2028);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    ScratchFile text_scratch("triangle_format_test", ".txt");
+    ScratchFile binary_scratch("triangle_format_test", ".bin");
+    const std::string& text_file = text_scratch.path();
+    const std::string& binary_file = binary_scratch.path();
+
+    TriangleFileReader reader(logger);
+    reader.write_text(text_file, triangle);
+    reader.write_binary(binary_file, triangle);
+
+    bool passed = reader.read_text(text_file) == triangle && TriangleFileReader::is_binary_file(binary_file) &&
+                  !TriangleFileReader::is_binary_file(text_file);
+    {
+        MappedTriangle mapped(binary_file);
+        auto [actual_sum, actual_path] = minimum_total_compact(mapped.view(), logger);
+        passed = passed && actual_sum == expected_sum && actual_path == expected_path;
+    }
+
+    auto rejected = [](const std::string& filename) {
+        try {
+            MappedTriangle mapped(filename);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+
+    {
+        std::fstream corrupt(binary_file, std::ios::in | std::ios::out | std::ios::binary);
+        corrupt.seekp(sizeof(TriangleFileHeader) + 5);
+        corrupt.put('\x7f');
+    }
+    passed = passed && rejected(binary_file);
+
+    // A truncated file, and a header claiming 2^63 rows, whose cell bytes wrap to exactly the empty payload
+    std::filesystem::resize_file(binary_file, sizeof(TriangleFileHeader) + 100);
+    passed = passed && rejected(binary_file);
+    {
+        TriangleFileHeader header{};
+        std::memcpy(header.magic, TRIANGLE_FILE_MAGIC, sizeof(TRIANGLE_FILE_MAGIC));
+        header.version = TRIANGLE_FILE_VERSION;
+        header.value_width = sizeof(int);
+        header.rows = uint64_t{1} << 63;
+        header.checksum = fnv1a_checksum(nullptr, 0);
+        std::ofstream oversized(binary_file, std::ios::binary | std::ios::trunc);
+        oversized.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    passed = passed && rejected(binary_file);
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Triangle File Formats", passed, expected_sum, {}};
+}
+
+TestResult run_out_of_core_solver_test(Logger& logger) {
+    logger.info("Verifying out-of-core solver with in-memory and spilled choice bits");
+
+    auto triangle = make_seeded_triangle(1200, 2032, -5, 5);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    ScratchFile binary_scratch("triangle_out_of_core_test", ".bin");
+    const std::string& binary_file = binary_scratch.path();
+    TriangleFileReader reader(logger);
+    reader.write_binary(binary_file, triangle);
+
+    bool passed = true;
+    OutOfCoreOptions in_memory;
+    OutOfCoreOptions spilled;
+    spilled.memory_limit_bytes = 128 * 1024;      // choice bits take about 95 KB
+    spilled.spill_buffer_bytes = 1024;
+    OutOfCoreOptions too_small;
+    too_small.memory_limit_bytes = 1024;
+
+    for (const auto& options : {in_memory, spilled}) {
+        auto [actual_sum, actual_path] = minimum_total_out_of_core(binary_file, logger, options);
+        passed = passed && actual_sum == expected_sum && actual_path == expected_path;
+    }
+    passed = passed && minimum_total_out_of_core(binary_file, logger, too_small).first == std::numeric_limits<int>::max();
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Out-of-core Solver", passed, expected_sum, {}};
+}
+
+TestResult run_streaming_solver_test(Logger& logger) {
+    logger.info("Verifying streaming solver path on a triangle with many ties");
+
+    auto triangle = make_seeded_triangle(400, 2026, 0, 2);
+    auto [expected_sum, expected_path] = minimum_total_compact(triangle, logger);
+
+    StreamingTriangleSolver solver(true);
+    for (const auto& row : triangle) {
+        solver.push_row(row);
+    }
+
+    std::vector<size_t> columns = solver.path_columns();
+    std::vector<int> actual_path;
+    for (size_t i = 0; i < columns.size(); ++i) {
+        actual_path.push_back(triangle[i][columns[i]]);
+    }
+
+    bool passed = (solver.minimum_sum() == expected_sum && actual_path == expected_path);
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Streaming Solver", passed, solver.minimum_sum(), {}};
+}
+
+TestResult run_compact_path_test(Logger& logger) {
+    logger.info("Verifying packed path results against the value paths");
+
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    bool passed = true;
+
+    for (size_t rows : {1, 2, 64, 65, 129, 700}) {
+        auto triangle = make_seeded_triangle(rows, 2034 + static_cast<unsigned>(rows), -3, 3);
+        auto [expected_sum, expected_path] = minimum_total_compact(triangle, quiet);
+        CompactPath path = minimum_total_compact_path(triangle, quiet);
+
+        passed = passed && path.size() == rows && path.sum() == expected_sum && path.values(triangle) == expected_path;
+        passed = passed && path.memory_bytes() == CompactPath::word_count(rows) * sizeof(uint64_t);
+
+        std::vector<size_t> columns = path.columns();
+        for (size_t row = 0; row < rows; ++row) {
+            passed = passed && path.column(row) == columns[row] && path.value(triangle, row) == expected_path[row];
+        }
+        passed = passed && CompactPath::from_columns(columns, expected_sum) == path;
+
+        std::string bytes = path.serialize();
+        passed = passed && CompactPath::deserialize(bytes) == path;
+
+        bool truncation_detected = false;
+        try {
+            CompactPath::deserialize(std::string_view(bytes).substr(0, bytes.size() - 1));
+        } catch (const std::runtime_error&) {
+            truncation_detected = true;
+        }
+        passed = passed && truncation_detected;
+    }
+
+    passed = passed && minimum_total_compact_path(std::vector<std::vector<int>>{}, quiet).empty();
+    passed = passed && CompactPath::word_count(100000) * sizeof(uint64_t) <= 12504;
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Compact Path", passed, 0, {}};
+}
+
+TestResult run_fixed_solver_test(Logger& logger) {
+    logger.info("Verifying the constexpr fixed-shape solver against minimum_total");
+
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    bool passed = true;
+
+    for (unsigned seed = 0; seed < 20; ++seed) {
+        auto nested = make_seeded_triangle(12, 2036 + seed, -3, 3);
+        FixedTriangle<12> triangle{};
+        for (size_t row = 0; row < nested.size(); ++row) {
+            std::copy(nested[row].begin(), nested[row].end(), triangle.cells.begin() + FixedTriangle<12>::offset(row));
+        }
+        passed = passed && triangle.to_nested() == nested;
+
+        auto [expected_sum, expected_path] = minimum_total(nested, quiet);
+        FixedPathResult<12> result = minimum_total_fixed(triangle);
+        passed = passed && result.sum == expected_sum &&
+                 std::equal(result.path.begin(), result.path.end(), expected_path.begin(), expected_path.end());
+        for (size_t row = 0; row < nested.size(); ++row) {
+            passed = passed && nested[row][result.columns[row]] == result.path[row];
+        }
+    }
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Fixed Shape Solver", passed, 0, {}};
+}
+
+TestResult run_huge_page_allocator_test(Logger& logger) {
+    logger.info("Verifying huge-page aware buffer allocation");
+    bool passed = true;
+
+    LargeBuffer<int> small(1000, 7);
+    passed = passed && reinterpret_cast<uintptr_t>(small.data()) % BUFFER_ALIGNMENT == 0 && small[999] == 7;
+
+    HugePageSettings prefaulted;
+    prefaulted.prefault = true;
+    size_t large_before = huge_page_stats().explicit_allocations + huge_page_stats().advised_allocations +
+                          huge_page_stats().regular_allocations;
+    {
+        LargeBuffer<uint64_t> large(3 * HUGE_PAGE_BYTES / sizeof(uint64_t) + 5, HugePageAllocator<uint64_t>(prefaulted));
+        passed = passed && reinterpret_cast<uintptr_t>(large.data()) % HUGE_PAGE_BYTES == 0;
+        passed = passed && std::all_of(large.begin(), large.end(), [](uint64_t word) { return word == 0; });
+        large.back() = 42;
+        passed = passed && large.back() == 42;
+        logger.info("Large buffer: " + huge_page_report());
+    }
+    size_t large_after = huge_page_stats().explicit_allocations + huge_page_stats().advised_allocations +
+                         huge_page_stats().regular_allocations;
+    passed = passed && large_after >= large_before + 1;    // the counters are process-wide, not per test
+
+    // minimum_total's choice bits reach a large buffer from about 5800 rows on
+    auto triangle = make_seeded_triangle(6000, 2035);
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    auto reference = minimum_total(triangle, quiet);
+    passed = passed && reference == minimum_total_compact(triangle, quiet);
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Huge Page Allocator", passed, reference.first, {}};
+}
+
+TestResult run_progress_monitor_test(Logger& logger) {
+    logger.info("Verifying progress counters and callbacks of minimum_total");
+    bool passed = true;
+
+#if TRIANGLE_PROGRESS
+    const size_t rows = 300;
+    auto triangle = make_seeded_triangle(rows, 2033);
+
+    std::vector<ProgressSnapshot> reports;
+    ProgressMonitor monitor(50, [&](const ProgressSnapshot& snapshot) { reports.push_back(snapshot); }, 10);
+
+    // Another thread reads snapshots, start time included, while begin() and row_done() run, and only ever sees
+    // the row counter move forward
+    std::atomic<bool> solving{true};
+    std::atomic<bool> monotonic{true};
+    std::thread watcher([&] {
+        size_t last = 0;
+        while (solving.load()) {
+            size_t now = monitor.snapshot().rows_done;
+            if (now < last && now != 0) monotonic = false;
+            last = now;
+            std::this_thread::yield();
+        }
+    });
+
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    auto result = minimum_total(triangle, quiet, &monitor);
+    solving = false;
+    watcher.join();
+
+    passed = result.first == minimum_total_compact(triangle, quiet).first && monotonic.load();
+    passed = passed && monitor.rows_done() == rows && monitor.total_rows() == rows &&
+             monitor.cells_done() == TriangleView::cell_count(rows);
+    passed = passed && reports.size() == rows / 50;
+    for (size_t i = 0; i < reports.size(); ++i) {
+        passed = passed && reports[i].rows_done == (i + 1) * 50 && reports[i].total_rows == rows;
+    }
+    passed = passed && !reports.empty() && reports.back().cells_per_second > 0;
+    logger.info("Window rate: " + std::to_string(monitor.cells_per_second()) + " cells/s");
+#else
+    logger.info("Progress hooks compiled out (TRIANGLE_PROGRESS=0)");
+#endif
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Progress Monitor", passed, 0, {}};
+}
+
+TestResult run_formatting_test(Logger& logger) {
+    logger.info("Verifying bounded formatting helpers");
+    bool passed = true;
+
+    std::vector<int> values = {3, -7, 2147483647, -2147483647 - 1, 0};
+    passed = passed && vectorToString(values) == "[3, -7, 2147483647, -2147483648, 0]";
+    passed = passed && pathToString({2, 3, 5, 1}) == "2 -> 3 -> 5 -> 1";
+    passed = passed && vectorToString({}) == "[]";
+    passed = passed && triangleToString({{2}, {3, 4}}) == "[[2], [3, 4]]";
+
+    passed = passed && format_vector(values, 2) == "[3, -7, ... (3 more)]";
+    passed = passed && format_path({1, 2, 3}, 0) == "... (3 more)";
+    passed = passed && format_triangle(make_seeded_triangle(20, 1, 0, 0), 2, 1) ==
+                       "[[0], [0, ... (1 more)], ... (18 more)]";
+
+    // Several views from the thread-local ring can be alive in one expression
+    std::string joined = std::string(format_path({1, 2})) + " | " + std::string(format_path({3, 4}));
+    passed = passed && joined == "1 -> 2 | 3 -> 4";
+
+    char small[8];
+    BufferSink sink(small, sizeof(small));
+    write_vector(sink, values);
+    passed = passed && sink.truncated() && sink.view() == "[3, -7, ";
+
+    std::vector<int> wide(10000);
+    for (size_t i = 0; i < wide.size(); ++i) wide[i] = static_cast<int>(i);
+    std::ostringstream streamed;
+    write_vector(StreamSink{streamed}, wide);
+    passed = passed && streamed.str() == vectorToString(wide) && streamed.str().size() > FORMAT_BUFFER_BYTES;
+
+    logger.info(passed ? LogMessages::TEST_PASSED : LogMessages::TEST_FAILED);
+    return {"Bounded Formatting", passed, 0, {}};
+}
+
+using TestTask = std::function<TestResult(Logger&)>;
+
+// Runs the tasks on a work-stealing pool; each task logs into its own buffer, and the buffers are written
+// to the main logger in task order as soon as every earlier task has finished
+std::vector<TestResult> run_tests_parallel(const std::vector<TestTask>& tasks, Logger& logger,
+                                           size_t thread_count = std::thread::hardware_concurrency()) {
+    struct Slot {
+        TestResult result;
+        std::string log;
+        bool done = false;
+    };
+
+    std::vector<Slot> slots(tasks.size());
+    std::mutex slots_mutex;
+    std::condition_variable slot_done;
+
+    WorkStealingPool pool(std::min(std::max<size_t>(thread_count, 1), std::max<size_t>(tasks.size(), 1)));
+    logger.info("Running " + std::to_string(tasks.size()) + " tests on " + std::to_string(pool.size()) + " threads");
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        pool.submit([&, i] {
+            Logger test_logger(false, true);
+            TestResult result;
+            try {
+                result = tasks[i](test_logger);
+            } catch (const std::exception& e) {
+                test_logger.error("Test threw: " + std::string(e.what()));
+                result = {"Test " + std::to_string(i + 1), false, 0, {}};
+            }
+
+            std::lock_guard<std::mutex> lock(slots_mutex);
+            slots[i].result = std::move(result);
+            slots[i].log = test_logger.take_buffer();
+            slots[i].done = true;
+            slot_done.notify_all();
+        });
+    }
+
+    std::vector<TestResult> results;
+    results.reserve(tasks.size());
+    for (size_t i = 0; i < slots.size(); ++i) {
+        std::string log;
+        {
+            std::unique_lock<std::mutex> lock(slots_mutex);
+            slot_done.wait(lock, [&] { return slots[i].done; });
+            log.swap(slots[i].log);
+            results.push_back(std::move(slots[i].result));
+        }
+        logger.write_block(log);
+    }
+    pool.wait();
+    return results;
+}
+
+std::vector<TestResult> run_test_suite(Logger& logger, size_t thread_count = std::thread::hardware_concurrency()) {
+    logger.info("RUNNING COMPREHENSIVE TEST SUITE");
+    
+    std::vector<TestCase> all_tests;
+    
+    auto basic_tests = TriangleTests::get_basic_tests();
+    all_tests.insert(all_tests.end(), basic_tests.begin(), basic_tests.end());
+    
+    auto edge_tests = TriangleTests::get_edge_tests();
+    all_tests.insert(all_tests.end(), edge_tests.begin(), edge_tests.end());
+    
+    auto large_tests = TriangleTests::get_large_tests();
+    all_tests.insert(all_tests.end(), large_tests.begin(), large_tests.end());
+    
+    std::vector<TestTask> tasks;
+    for (size_t i = 0; i < all_tests.size(); ++i) {
+        tasks.push_back([&all_tests, i](Logger& test_logger) { return run_test(all_tests[i], i + 1, test_logger); });
+    }
     
+    // Triangles are drawn up front so the generator is used from one thread only
     TriangleGenerator generator;
-    std::vector<int> sizes = {10, 20, 50, 100};
+    std::vector<std::vector<std::vector<int>>> random_triangles;
+    for (int i = 0; i < 3; ++i) {
+        int rows = 3 + (i * 2); // 3, 5, 7 rows
+        random_triangles.push_back(generator.generate_random_triangle(rows));
+    }
     
-    for (int size : sizes) {
-        auto triangle = generator.generate_random_triangle(size, -100, 100);
-        
-        auto start = std::chrono::high_resolution_clock::now();
-        auto [min_sum, path] = minimum_total(triangle, logger);
-        auto end = std::chrono::high_resolution_clock::now();
-        
-        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
-        double execution_time = duration.count() / 1000000.0;
-        
-        logger.info("Size: " + std::to_string(size) + ", Time: " + 
-                   std::to_string(execution_time) + "s, Min Sum: " + std::to_string(min_sum));
+    for (size_t i = 0; i < random_triangles.size(); ++i) {
+        int test_number = all_tests.size() + i + 1;
+        tasks.push_back([&random_triangles, i, test_number](Logger& test_logger) {
+            auto [expected_sum, expected_path] = minimum_total(random_triangles[i], test_logger);
+            TestCase random_test = {
+                "Random Test " + std::to_string(i + 1),
+                random_triangles[i],
+                expected_sum,
+                expected_path
+            };
+            return run_test(random_test, test_number, test_logger);
+        });
+    }
+    
+    tasks.push_back(run_row_kernel_tests);
+    tasks.push_back(run_parallel_solver_test);
+    tasks.push_back(run_tiled_solver_test);
+    tasks.push_back(run_checkpointed_solver_test);
+    tasks.push_back(run_streaming_solver_test);
+    tasks.push_back(run_file_format_test);
+    tasks.push_back(run_out_of_core_solver_test);
+    tasks.push_back(run_value_type_test);
+    tasks.push_back(run_batch_solver_test);
+    tasks.push_back(run_incremental_solver_test);
+    tasks.push_back(run_online_solver_test);
+    tasks.push_back(run_k_best_paths_test);
+    tasks.push_back(run_move_policy_test);
+    tasks.push_back(run_semiring_test);
+    tasks.push_back(run_seeded_generator_test);
+    tasks.push_back(run_formatting_test);
+    tasks.push_back(run_progress_monitor_test);
+    tasks.push_back(run_compact_path_test);
+    tasks.push_back(run_huge_page_allocator_test);
+    tasks.push_back(run_fixed_solver_test);
+    
+    return run_tests_parallel(tasks, logger, thread_count);
+}
+
+void print_test_summary(const std::vector<TestResult>& results, Logger& logger) {
+    logger.info("TEST SUMMARY");
+    
+    int passed_count = 0;
+    for (const auto& result : results) {
+        if (result.passed) passed_count++;
+    }
+    
+    int total_count = results.size();
+    
+    logger.info("Total Tests: " + std::to_string(total_count));
+    logger.info("Passed: " + std::to_string(passed_count));
+    logger.info("Failed: " + std::to_string(total_count - passed_count));
+    logger.info("Success Rate: " + std::to_string(static_cast<double>(passed_count) / total_count * 100) + "%");
+    
+    logger.info("Detailed Results:");
+    for (const auto& result : results) {
+        std::string status = result.passed ? "PASS" : "FAIL";
+        logger.info(result.name + " " + status + " Sum: " + std::to_string(result.actual_sum) + 
+                   " Path: " + std::string(format_path(result.actual_path)));
+    }
+}
+
+struct BenchmarkOptions {
+    std::vector<size_t> sizes = {10, 20, 50, 100};
+    size_t warmup_runs = 2;
+    size_t min_trials = 5;
+    size_t max_trials = 50;
+    double target_relative_ci = 0.02;      // stop when the 95% CI half-width is within 2% of the mean
+    double max_seconds_per_case = 3.0;
+    size_t memory_budget_bytes = 0;        // 0: three quarters of physical memory
+    std::string json_path;
+};
+
+struct BenchmarkResult {
+    std::string variant;
+    size_t rows;
+    size_t cells;
+    size_t trials;
+    double mean_seconds;
+    double stddev_seconds;
+    double ci95_seconds;
+    int min_sum;
+};
+
+// Two-sided 95% Student t quantile for df degrees of freedom
+double student_t95(size_t df) {
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df == 0) return std::numeric_limits<double>::infinity();
+    return df <= 30 ? table[df - 1] : 1.96;
+}
+
+// Warm-up stops early once it alone has used the time budget, so single runs of 10^5 rows are not repeated needlessly
+BenchmarkResult benchmark_trials(const std::string& name, size_t rows, const std::function<int()>& solve,
+                                 const BenchmarkOptions& options) {
+    int min_sum = 0;
+    auto warmup_start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < options.warmup_runs; ++i) {
+        min_sum = solve();
+        double warmup_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - warmup_start).count();
+        if (warmup_seconds >= options.max_seconds_per_case) break;
+    }
+
+    std::vector<double> times;
+    double total = 0;
+    double mean = 0, stddev = 0, ci = 0;
+    while (times.size() < options.max_trials) {
+        auto start = std::chrono::steady_clock::now();
+        min_sum = solve();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        times.push_back(seconds);
+        total += seconds;
+
+        mean = total / times.size();
+        double squares = 0;
+        for (double t : times) squares += (t - mean) * (t - mean);
+        stddev = times.size() > 1 ? std::sqrt(squares / (times.size() - 1)) : 0.0;
+        ci = student_t95(times.size() - 1) * stddev / std::sqrt(static_cast<double>(times.size()));
+
+        if (times.size() >= options.min_trials && ci <= options.target_relative_ci * mean) break;
+        if (total >= options.max_seconds_per_case && times.size() >= 2) break;
+    }
+
+    return {name, rows, TriangleView::cell_count(rows), times.size(), mean, stddev, ci, min_sum};
+}
+
+BenchmarkResult benchmark_variant(const SolverVariant& variant, const std::vector<std::vector<int>>& triangle,
+                                  const BenchmarkOptions& options) {
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    return benchmark_trials(variant.name, triangle.size(), [&] { return variant.solve(triangle, quiet).first; }, options);
+}
+
+// Streaming solve over rows produced on the fly by the counter-based generator: the triangle is never stored, so
+// this is the one variant that fits sizes whose input alone exceeds memory. Its time includes generating the rows
+BenchmarkResult benchmark_generated_stream(const SeededTriangleGenerator& generator, size_t rows,
+                                           const BenchmarkOptions& options) {
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    return benchmark_trials("streaming_generated", rows, [&] {
+        size_t next = 0;
+        return minimum_total_stream([&](std::vector<int>& row) {
+            if (next == rows) return false;
+            row.resize(next + 1);
+            uint64_t offset = TriangleView::cell_count(next);
+            for (size_t j = 0; j <= next; ++j) {
+                row[j] = generator.cell(offset + j, -100, 100, ValueDistribution::Uniform);
+            }
+            ++next;
+            return true;
+        }, quiet).first;
+    }, options);
+}
+
+size_t physical_memory_bytes() {
+    long pages = ::sysconf(_SC_PHYS_PAGES);
+    long page_size = ::sysconf(_SC_PAGESIZE);
+    return pages > 0 && page_size > 0 ? static_cast<size_t>(pages) * static_cast<size_t>(page_size) : 0;
+}
+
+void write_benchmark_json(const std::string& filename, const std::vector<BenchmarkResult>& results, Logger& logger) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        logger.error("Cannot open benchmark output file: " + filename);
+        return;
+    }
+
+    file << "{\n  \"row_kernel\": \"" << row_kernel_name() << "\",\n";
+    file << "  \"threads\": " << ThreadPool::shared().size() << ",\n";
+    const HugePageStats& pages = huge_page_stats();
+    file << "  \"huge_pages\": {\"explicit_buffers\": " << pages.explicit_allocations.load()
+         << ", \"advised_buffers\": " << pages.advised_allocations.load()
+         << ", \"regular_buffers\": " << pages.regular_allocations.load()
+         << ", \"anon_huge_page_bytes\": " << anon_huge_page_bytes() << "},\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        file << "    {\"variant\": \"" << r.variant << "\", \"rows\": " << r.rows << ", \"cells\": " << r.cells
+             << ", \"trials\": " << r.trials << ", \"mean_s\": " << r.mean_seconds
+             << ", \"stddev_s\": " << r.stddev_seconds << ", \"ci95_s\": " << r.ci95_seconds
+             << ", \"cells_per_s\": " << r.cells / r.mean_seconds
+             << ", \"input_gb_per_s\": " << r.cells * sizeof(int) / r.mean_seconds / 1e9
+             << ", \"min_sum\": " << r.min_sum << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    logger.info("Benchmark results written to " + filename);
+}
+
+// Every solver variant is timed separately with logging off: warm-up runs, then trials until the 95% confidence
+// interval is tight or the time budget for the case is spent
+std::vector<BenchmarkResult> benchmark_algorithm(Logger& logger, const BenchmarkOptions& options = BenchmarkOptions()) {
+    logger.info("BENCHMARK WITH LARGE TRIANGLES");
+    logger.info("Row kernel: " + row_kernel_name() + ", threads: " + std::to_string(ThreadPool::shared().size()));
+
+    std::vector<SolverVariant> variants = {
+        {"minimum_total", [](const std::vector<std::vector<int>>& triangle, Logger& solver_logger) {
+            return minimum_total(triangle, solver_logger);
+        }}
+    };
+    for (auto& variant : get_solver_variants()) {
+        variants.push_back(variant);
+    }
+
+    size_t budget = options.memory_budget_bytes ? options.memory_budget_bytes : physical_memory_bytes() / 4 * 3;
+    logger.info("Memory budget: " + std::to_string(budget >> 20) + " MB");
+
+    SeededTriangleGenerator generator(2024);
+    std::vector<BenchmarkResult> results;
+
+    for (size_t size : options.sizes) {
+        size_t cells = TriangleView::cell_count(size);
+        // Each row vector holds its cells plus the allocation header and the vector itself
+        double input_bytes = cells * sizeof(int) + size * (sizeof(std::vector<int>) + 16.0);
+        auto working_bytes = [&](double bytes_per_cell) { return bytes_per_cell * cells + 4.0 * size * sizeof(int); };
+
+        size_t first_result = results.size();
+        std::vector<std::vector<int>> triangle;
+        if (input_bytes + working_bytes(0.125) <= budget) {
+            triangle = generator.generate(size, -100, 100).to_nested();
+        } else {
+            logger.warning("Size " + std::to_string(size) + ": the stored triangle (" +
+                           std::to_string(static_cast<size_t>(input_bytes) >> 20) +
+                           " MB) exceeds the memory budget, only the generated stream runs");
+        }
+
+        for (const auto& variant : variants) {
+            if (triangle.empty()) break;
+            if (input_bytes + working_bytes(variant.bytes_per_cell) > budget) {
+                logger.warning("Skipping " + variant.name + " at " + std::to_string(size) +
+                               " rows: its working memory exceeds the memory budget");
+                continue;
+            }
+
+            BenchmarkResult result = benchmark_variant(variant, triangle, options);
+            results.push_back(result);
+            logger.info("Size: " + std::to_string(size) + ", Variant: " + result.variant +
+                        ", Time: " + std::to_string(result.mean_seconds) + "s +/- " + std::to_string(result.ci95_seconds) +
+                        "s (" + std::to_string(result.trials) + " trials), Cells/s: " +
+                        std::to_string(result.cells / result.mean_seconds) + ", Input GB/s: " +
+                        std::to_string(result.cells * sizeof(int) / result.mean_seconds / 1e9) +
+                        ", Min Sum: " + std::to_string(result.min_sum));
+
+            if (result.min_sum != results[first_result].min_sum) {
+                logger.warning("Variant " + result.variant + " disagrees on the minimum sum");
+            }
+        }
+
+        triangle = {};
+        if (working_bytes(0.125) > budget) {
+            logger.warning("Skipping " + std::to_string(size) + " rows: choice bits exceed the memory budget");
+            continue;
+        }
+        BenchmarkResult streamed = benchmark_generated_stream(generator, size, options);
+        results.push_back(streamed);
+        logger.info("Size: " + std::to_string(size) + ", Variant: " + streamed.variant +
+                    ", Time: " + std::to_string(streamed.mean_seconds) + "s +/- " + std::to_string(streamed.ci95_seconds) +
+                    "s (" + std::to_string(streamed.trials) + " trials), Cells/s: " +
+                    std::to_string(streamed.cells / streamed.mean_seconds) + ", Min Sum: " + std::to_string(streamed.min_sum));
+        if (results.size() > first_result + 1 && streamed.min_sum != results[first_result].min_sum) {
+            logger.warning("Variant " + streamed.variant + " disagrees on the minimum sum");
+        }
+    }
+
+    logger.info("Huge pages: " + huge_page_report());
+    if (!options.json_path.empty()) {
+        write_benchmark_json(options.json_path, results, logger);
     }
+    return results;
+}
+
+int solve_triangle_file(const std::string& filename, Logger& logger) {
+    if (TriangleFileReader::is_binary_file(filename)) {
+        MappedTriangle mapped(filename);
+        auto [min_sum, path] = minimum_total_compact(mapped.view(), logger);
+        return min_sum == std::numeric_limits<int>::max() ? 1 : 0;
+    }
+
+    TriangleFileReader reader(logger);
+    auto [min_sum, path] = minimum_total_compact(reader.read_text(filename), logger);
+    return min_sum == std::numeric_limits<int>::max() ? 1 : 0;
+}
+
+// Machine-readable solve for benchmark_compare.py: logging off, result and solve time on stdout
+int solve_triangle_quiet(const std::string& filename) {
+    Logger quiet(false);
+    quiet.set_enabled(false);
+    TriangleFileReader reader(quiet);
+    auto triangle = reader.read_text(filename);
+
+    auto start = std::chrono::steady_clock::now();
+    auto [min_sum, path] = minimum_total(triangle, quiet);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "sum " << min_sum << "\npath ";
+    write_path(StreamSink{std::cout}, path);
+    std::cout << "\nseconds " << seconds << "\npeak_kb " << peak_resident_memory_bytes() / 1024 << std::endl;
+    return min_sum == std::numeric_limits<int>::max() ? 1 : 0;
 }
 
-int main() {
+int main(int argc, char* argv[]) {
     try {
+        if (argc == 3 && std::string(argv[1]) == "--solve-quiet") {
+            return solve_triangle_quiet(argv[2]);
+        }
+        
         Logger logger;
         
+        if (argc == 4 && std::string(argv[1]) == "--to-binary") {
+            TriangleFileReader reader(logger);
+            reader.write_binary(argv[3], reader.read_text(argv[2]));
+            return 0;
+        }
+        if (argc >= 2 && std::string(argv[1]) == "--benchmark") {
+            BenchmarkOptions options;
+            options.sizes = {100, 1000, 10000, 100000};
+            options.json_path = argc >= 3 ? argv[2] : "benchmark_results.json";
+            if (argc >= 4) options.memory_budget_bytes = std::stoull(argv[3]) << 20;
+            benchmark_algorithm(logger, options);
+            return 0;
+        }
+        if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--out-of-core") {
+            OutOfCoreOptions options;
+            if (argc == 4) options.memory_limit_bytes = std::stoull(argv[3]) << 20;
+            auto [min_sum, path] = minimum_total_out_of_core(argv[2], logger, options);
+            return min_sum == std::numeric_limits<int>::max() ? 1 : 0;
+        }
+        if (argc == 2) {
+            return solve_triangle_file(argv[1], logger);
+        }
+        
         auto test_results = run_test_suite(logger);
         
         print_test_summary(test_results, logger);